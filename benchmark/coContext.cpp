@@ -4,18 +4,28 @@
 using namespace std::string_view_literals;
 
 [[nodiscard]] auto acceptAction(const std::int32_t socket) -> coContext::Task<> {
+    coContext::SendQueue sendQueue{socket, 0, coContext::direct()};
+
     co_await coContext::multipleReceive(
-        [socket]([[maybe_unused]] const std::int32_t result,
-                 [[maybe_unused]] const std::span<const std::byte> receivedData) -> coContext::Task<> {
+        [&sendQueue]([[maybe_unused]] const std::int32_t result,
+                     const std::span<const std::byte> receivedData) -> coContext::Task<> {
             static constexpr auto response{
                 "HTTP/1.1 200 OK\r\n"
                 "Content-Length: 0\r\n"
                 "\r\n"sv};
 
-            co_await (coContext::send(socket, std::as_bytes(std::span{response}), 0) | coContext::direct());
+            const std::string_view requests{reinterpret_cast<const char *>(std::data(receivedData)),
+                                            std::size(receivedData)};
+            for (std::size_t position{requests.find("\r\n\r\n"sv)}; position != std::string_view::npos;
+                 position = requests.find("\r\n\r\n"sv, position + 4))
+                sendQueue.post(std::as_bytes(std::span{response}));
+
+            co_return;
         },
         socket, 0, coContext::direct());
 
+    co_await sendQueue.send({});
+
     co_await coContext::closeDirect(socket);
 }
 
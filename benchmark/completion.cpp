@@ -0,0 +1,33 @@
+#include <chrono>
+#include <coContext/coContext.hpp>
+#include <print>
+
+namespace {
+    constexpr std::uint32_t taskCount{4096}, rounds{1024};
+
+    std::uint32_t remainingTaskCount{taskCount};
+    std::chrono::steady_clock::time_point start;
+
+    // every round is one completion drained by Context::processCompletions and one resumption of its coroutine
+    [[nodiscard]] auto submitNoOperations() -> coContext::Task<> {
+        for (std::uint32_t i{}; i != rounds; ++i) co_await coContext::noOperation();
+
+        if (--remainingTaskCount != 0) co_return;
+
+        const std::chrono::nanoseconds elapsed{std::chrono::steady_clock::now() - start};
+        std::println("{:.2f} ns/completion",
+                     static_cast<double>(elapsed.count()) / static_cast<double>(std::uint64_t{taskCount} * rounds));
+
+        coContext::stop();
+    }
+}    // namespace
+
+[[nodiscard]] auto main() -> int {
+    coContext::logger::stop();
+    coContext::logger::disableWrite();
+
+    start = std::chrono::steady_clock::now();
+    for (std::uint32_t i{}; i != taskCount; ++i) spawn(submitNoOperations);
+
+    coContext::run();
+}
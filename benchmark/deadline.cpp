@@ -0,0 +1,53 @@
+#include <array>
+#include <coContext/coContext.hpp>
+#include <print>
+#include <sys/socket.h>
+
+namespace {
+    constexpr std::uint32_t rounds{1 << 20};
+
+    [[nodiscard]] auto receiveRounds(const std::array<std::int32_t, 2> sockets, const bool isDeadline)
+        -> coContext::Task<std::chrono::nanoseconds> {
+        std::byte data{};
+
+        const auto start{std::chrono::steady_clock::now()};
+        for (std::uint32_t i{}; i != rounds; ++i) {
+            co_await coContext::send(sockets[0], std::span{std::addressof(data), 1}, 0);
+
+            if (isDeadline) {
+                co_await (coContext::receive(sockets[1], std::span{std::addressof(data), 1}, 0) |
+                          coContext::timeout(std::chrono::seconds{1}));
+            } else co_await coContext::receive(sockets[1], std::span{std::addressof(data), 1}, 0);
+        }
+
+        co_return (std::chrono::steady_clock::now() - start) / rounds;
+    }
+
+    [[nodiscard]] auto benchmark() -> coContext::Task<> {
+        std::array<std::int32_t, 2> sockets;
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, std::data(sockets)) == -1) {
+            coContext::stop();
+
+            co_return;
+        }
+
+        const std::chrono::nanoseconds plain{co_await receiveRounds(sockets, false)},
+            deadline{co_await receiveRounds(sockets, true)};
+
+        std::println("receive: {}, receive with deadline: {}", plain, deadline);
+
+        co_await coContext::close(sockets[0]);
+        co_await coContext::close(sockets[1]);
+
+        coContext::stop();
+    }
+}    // namespace
+
+[[nodiscard]] auto main() -> int {
+    coContext::logger::stop();
+    coContext::logger::disableWrite();
+
+    spawn(benchmark);
+
+    coContext::run();
+}
@@ -1,9 +1,20 @@
 #pragma once
 
+#include "context/Clock.hpp"
+#include "context/Runtime.hpp"
+#include "context/Timer.hpp"
 #include "coroutine/AsyncWaiter.hpp"
+#include "coroutine/CancellationScope.hpp"
 #include "coroutine/Marker.hpp"
 #include "coroutine/Task.hpp"
 #include "log/logger.hpp"
+#include "memory/frame.hpp"
+#include "ring/BufferLease.hpp"
+#include "ring/FixedBuffer.hpp"
+#include "ring/ReceivedMessage.hpp"
+#include "ring/SendQueue.hpp"
+
+#include <functional>
 
 namespace coContext {
     template<internal::Returnable T = void>
@@ -26,51 +37,104 @@ namespace coContext {
 
     enum class ClockSource : std::uint8_t { monotonic, absolute, boot, real };
 
+    enum class BufferGroup : std::uint8_t { automatic, small, medium, large };
+
     namespace internal {
-        auto spawn(Coroutine coroutine) -> void;
+        auto spawn(Coroutine coroutine) -> std::uint64_t;
+
+        auto spawnOn(std::uint32_t contextId, Coroutine coroutine) -> void;
     }    // namespace internal
 
+    auto configure(const ContextOptions &options) -> void;
+
+    [[nodiscard]] auto getBufferStatistics(BufferGroup bufferGroup) -> BufferStatistics;
+
+    [[nodiscard]] auto getTimerStatistics() -> TimerStatistics;
+
+    [[nodiscard]] auto allocateFixedBuffer(std::size_t size) -> FixedBuffer;
+
+    auto releaseFixedBuffer(FixedBuffer buffer) -> void;
+
+    [[nodiscard]] auto getRingFileDescriptor() -> std::int32_t;
+
     auto run() -> void;
 
     auto stop() -> void;
 
+    // inside a runtime the task goes to the least loaded context, where an idle one may steal it before it starts, so
+    // its frame comes from the shared resource and its taskId is BasePromise::invalidId; spawnOn keeps it in place
     template<std::movable T, typename F, typename... Args>
         requires std::is_invocable_r_v<Task<T>, F, Args...>
     constexpr auto spawn(F &&f, Args &&...args) {
+        const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
         Task<T> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+        std::future<T> value{task.getReturnValue()};
 
-        internal::Coroutine coroutine{std::move(task.getCoroutine())};
-        const std::uint64_t id{std::hash<internal::Coroutine>{}(coroutine)};
+        const std::uint64_t id{spawn(std::move(task.getCoroutine()))};
 
-        spawn(std::move(coroutine));
-
-        return SpawnResult{std::move(task.getReturnValue()), id};
+        return SpawnResult{std::move(value), id};
     }
 
     template<typename T, typename F, typename... Args>
         requires std::is_lvalue_reference_v<T> && std::is_invocable_r_v<Task<T &>, F, Args...>
     constexpr auto spawn(F &&f, Args &&...args) {
+        const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
         Task<T &> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+        std::future<T &> value{task.getReturnValue()};
 
-        internal::Coroutine coroutine{std::move(task.getCoroutine())};
-        const std::uint64_t id{std::hash<internal::Coroutine>{}(coroutine)};
-
-        spawn(std::move(coroutine));
+        const std::uint64_t id{spawn(std::move(task.getCoroutine()))};
 
-        return SpawnResult{std::move(task.getReturnValue()), id};
+        return SpawnResult{std::move(value), id};
     }
 
     template<typename F, typename... Args>
         requires std::is_invocable_r_v<Task<>, F, Args...>
     constexpr auto spawn(F &&f, Args &&...args) {
+        const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
         Task<> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+        std::future<void> value{task.getReturnValue()};
+
+        const std::uint64_t id{spawn(std::move(task.getCoroutine()))};
+
+        return SpawnResult{std::move(value), id};
+    }
+
+    [[nodiscard]] auto getContextId() -> std::uint32_t;
+
+    template<std::movable T, typename F, typename... Args>
+        requires std::is_invocable_r_v<Task<T>, F, Args...>
+    constexpr auto spawnOn(const std::uint32_t contextId, F &&f, Args &&...args) {
+        const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
+        Task<T> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+        std::future<T> value{task.getReturnValue()};
+
+        spawnOn(contextId, std::move(task.getCoroutine()));
+
+        return value;
+    }
+
+    template<typename T, typename F, typename... Args>
+        requires std::is_lvalue_reference_v<T> && std::is_invocable_r_v<Task<T &>, F, Args...>
+    constexpr auto spawnOn(const std::uint32_t contextId, F &&f, Args &&...args) {
+        const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
+        Task<T &> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+        std::future<T &> value{task.getReturnValue()};
+
+        spawnOn(contextId, std::move(task.getCoroutine()));
+
+        return value;
+    }
 
-        internal::Coroutine coroutine{std::move(task.getCoroutine())};
-        const std::uint64_t id{std::hash<internal::Coroutine>{}(coroutine)};
+    template<typename F, typename... Args>
+        requires std::is_invocable_r_v<Task<>, F, Args...>
+    constexpr auto spawnOn(const std::uint32_t contextId, F &&f, Args &&...args) {
+        const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
+        Task<> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+        std::future<void> value{task.getReturnValue()};
 
-        spawn(std::move(coroutine));
+        spawnOn(contextId, std::move(task.getCoroutine()));
 
-        return SpawnResult{std::move(task.getReturnValue()), id};
+        return value;
     }
 
     [[nodiscard]] auto syncCancel(std::uint64_t taskId, std::chrono::seconds seconds = {},
@@ -86,8 +150,10 @@ namespace coContext {
 
     [[nodiscard]] auto direct() noexcept -> internal::Marker;
 
+    // a non-zero slack rounds the expiry up to a multiple of it on the chosen clock, so that the timeouts armed within
+    // one slack expire together and are completed by one wakeup
     [[nodiscard]] auto timeout(std::chrono::seconds seconds, std::chrono::nanoseconds nanoseconds = {},
-                               ClockSource clockSource = {}) -> internal::Marker;
+                               ClockSource clockSource = {}, std::chrono::nanoseconds slack = {}) -> internal::Marker;
 
     [[nodiscard]] auto noOperation() -> internal::AsyncWaiter;
 
@@ -98,7 +164,8 @@ namespace coContext {
     [[nodiscard]] auto cancelAny() -> internal::AsyncWaiter;
 
     [[nodiscard]] auto sleep(std::chrono::seconds seconds, std::chrono::nanoseconds nanoseconds = {},
-                             ClockSource clockSource = {}) -> internal::AsyncWaiter;
+                             ClockSource clockSource = {}, std::chrono::nanoseconds slack = {})
+        -> internal::AsyncWaiter;
 
     [[nodiscard]] auto updateSleep(std::uint64_t taskId, std::chrono::seconds seconds,
                                    std::chrono::nanoseconds nanoseconds = {}, ClockSource clockSource = {})
@@ -176,8 +243,24 @@ namespace coContext {
 
     [[nodiscard]] auto
         multipleReceive(std::move_only_function<auto(std::int32_t, std::span<const std::byte>)->Task<>> action,
-                        std::int32_t socketFileDescriptor, std::int32_t flags, internal::Marker marker = none())
-            -> Task<>;
+                        std::int32_t socketFileDescriptor, std::int32_t flags, internal::Marker marker = none(),
+                        BufferGroup bufferGroup = BufferGroup::automatic) -> Task<>;
+
+    [[nodiscard]] auto multipleReceive(std::move_only_function<auto(std::int32_t, BufferLease)->Task<>> action,
+                                       std::int32_t socketFileDescriptor, std::int32_t flags,
+                                       internal::Marker marker = none(),
+                                       BufferGroup bufferGroup = BufferGroup::automatic) -> Task<>;
+
+    [[nodiscard]] auto multipleReceiveBundle(
+        std::move_only_function<auto(std::int32_t, std::pmr::vector<BufferLease>)->Task<>> action,
+        std::int32_t socketFileDescriptor, std::int32_t flags, internal::Marker marker = none(),
+        BufferGroup bufferGroup = BufferGroup::automatic) -> Task<>;
+
+    [[nodiscard]] auto
+        multipleReceiveMessage(std::move_only_function<auto(std::int32_t, ReceivedMessage)->Task<>> action,
+                               std::int32_t socketFileDescriptor, socklen_t addressLength, std::size_t controlLength,
+                               std::uint32_t flags, internal::Marker marker = none(),
+                               BufferGroup bufferGroup = BufferGroup::automatic) -> Task<>;
 
     [[nodiscard]] auto send(std::int32_t socketFileDescriptor, std::span<const std::byte> buffer, std::int32_t flags)
         -> internal::AsyncWaiter;
@@ -189,13 +272,21 @@ namespace coContext {
     [[nodiscard]] auto send(std::int32_t socketFileDescriptor, const msghdr *message, std::uint32_t flags)
         -> internal::AsyncWaiter;
 
-    [[nodiscard]] auto zeroCopySend(std::move_only_function<auto(std::int32_t)->Task<>> action,
-                                    std::int32_t socketFileDescriptor, std::span<const std::byte> buffer,
-                                    std::int32_t flags, internal::Marker marker = none()) -> Task<>;
+    [[nodiscard]] auto sendFixed(std::int32_t socketFileDescriptor, FixedBuffer buffer, std::int32_t flags)
+        -> internal::AsyncWaiter;
+
+    // taken right away like any other send, so it links, takes markers and timeouts and belongs to the caller's
+    // cancellation scope; the sender resumes on the result, release runs once the kernel no longer reads the data, a
+    // linked send should pass MSG_WAITALL so that a short send fails the chain
+    [[nodiscard]] auto zeroCopySend(std::int32_t socketFileDescriptor, std::span<const std::byte> buffer,
+                                    std::int32_t flags, std::move_only_function<auto()->void> release = {})
+        -> internal::AsyncWaiter;
+
+    [[nodiscard]] auto zeroCopySend(std::int32_t socketFileDescriptor, const msghdr *message, std::int32_t flags,
+                                    std::move_only_function<auto()->void> release = {}) -> internal::AsyncWaiter;
 
-    [[nodiscard]] auto zeroCopySend(std::move_only_function<auto(std::int32_t)->Task<>> action,
-                                    std::int32_t socketFileDescriptor, const msghdr *message, std::int32_t flags,
-                                    internal::Marker marker = none()) -> Task<>;
+    [[nodiscard]] auto zeroCopySendFixed(std::int32_t socketFileDescriptor, FixedBuffer buffer, std::int32_t flags,
+                                         std::move_only_function<auto()->void> release = {}) -> internal::AsyncWaiter;
 
     [[nodiscard]] auto splice(std::int32_t inFileDescriptor, std::int64_t inOffset, std::int32_t outFileDescriptor,
                               std::int64_t outOffset, std::uint32_t length, std::uint32_t flags)
@@ -231,9 +322,18 @@ namespace coContext {
     [[nodiscard]] auto read(std::int32_t fileDescriptor, std::span<const iovec> buffer, std::uint64_t offset,
                             std::int32_t flags) -> internal::AsyncWaiter;
 
+    [[nodiscard]] auto readFixed(std::int32_t fileDescriptor, FixedBuffer buffer, std::uint64_t offset = -1)
+        -> internal::AsyncWaiter;
+
     [[nodiscard]] auto
         multipleRead(std::move_only_function<auto(std::int32_t, std::span<const std::byte>)->Task<>> action,
-                     std::int32_t fileDescriptor, std::int32_t offset = -1, internal::Marker marker = none()) -> Task<>;
+                     std::int32_t fileDescriptor, std::int32_t offset = -1, internal::Marker marker = none(),
+                     BufferGroup bufferGroup = BufferGroup::automatic) -> Task<>;
+
+    [[nodiscard]] auto multipleRead(std::move_only_function<auto(std::int32_t, BufferLease)->Task<>> action,
+                                    std::int32_t fileDescriptor, std::int32_t offset = -1,
+                                    internal::Marker marker = none(),
+                                    BufferGroup bufferGroup = BufferGroup::automatic) -> Task<>;
 
     [[nodiscard]] auto write(std::int32_t fileDescriptor, std::span<const std::byte> buffer, std::uint64_t offset = -1)
         -> internal::AsyncWaiter;
@@ -244,6 +344,9 @@ namespace coContext {
     [[nodiscard]] auto write(std::int32_t fileDescriptor, std::span<const iovec> buffer, std::uint64_t offset,
                              std::int32_t flags) -> internal::AsyncWaiter;
 
+    [[nodiscard]] auto writeFixed(std::int32_t fileDescriptor, FixedBuffer buffer, std::uint64_t offset = -1)
+        -> internal::AsyncWaiter;
+
     [[nodiscard]] auto syncFile(std::int32_t fileDescriptor, bool isSyncMetadata = true) -> internal::AsyncWaiter;
 
     [[nodiscard]] auto syncFile(std::int32_t fileDescriptor, std::uint64_t offset, std::uint32_t length,
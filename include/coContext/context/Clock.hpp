@@ -0,0 +1,18 @@
+#pragma once
+
+#include <chrono>
+
+namespace coContext {
+    namespace internal {
+        auto refreshClock() noexcept -> void;
+
+        auto invalidateClock() noexcept -> void;
+    }    // namespace internal
+
+    // sampled once per event loop iteration while a context runs on this thread, so that every task resumed by one
+    // completion batch sees the same time; read from the clock directly anywhere else
+    [[nodiscard]] auto now() noexcept -> std::chrono::steady_clock::time_point;
+
+    // the wall clock at tick resolution, sampled alongside now()
+    [[nodiscard]] auto wallNow() noexcept -> std::chrono::system_clock::time_point;
+}    // namespace coContext
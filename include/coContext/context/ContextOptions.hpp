@@ -0,0 +1,25 @@
+#pragma once
+
+#include "../ring/BufferPolicy.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace coContext {
+    struct ContextOptions {
+        std::uint32_t submissionEntries{32768}, completionEntries{};
+        bool isSubmissionPoll{};
+        std::int32_t submissionPollCpu{-1};
+        std::chrono::milliseconds submissionPollIdle{};
+        bool isNoSubmissionArray{};
+        std::int32_t workQueueRingFileDescriptor{-1};
+        std::uint32_t directFileDescriptorCount{65536};
+        BufferPolicy bufferPolicy{};
+        bool isHugePageBuffer{}, isHugePageFrame{};
+        std::uint32_t fixedBufferCount{256};
+        std::size_t fixedBufferSize{4096};
+        std::size_t zeroCopyThreshold{16384};
+        std::chrono::nanoseconds timerTick{std::chrono::milliseconds{1}};
+    };
+}    // namespace coContext
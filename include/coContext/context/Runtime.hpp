@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../coroutine/Task.hpp"
+#include "ContextOptions.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace coContext {
+    namespace internal {
+        class Scheduler;
+
+        auto run(Scheduler &scheduler, std::uint32_t index, const ContextOptions &options) -> void;
+    }    // namespace internal
+
+    class Runtime {
+    public:
+        explicit Runtime(std::uint32_t contextCount = std::thread::hardware_concurrency(),
+                         ContextOptions options = ContextOptions{});
+
+        Runtime(const Runtime &) = delete;
+
+        auto operator=(const Runtime &) -> Runtime & = delete;
+
+        Runtime(Runtime &&) noexcept;
+
+        auto operator=(Runtime &&) noexcept -> Runtime &;
+
+        ~Runtime();
+
+        auto swap(Runtime &other) noexcept -> void;
+
+        [[nodiscard]] auto getContextCount() const noexcept -> std::uint32_t;
+
+        auto run() -> void;
+
+        auto stop() noexcept -> void;
+
+        template<std::movable T, typename F, typename... Args>
+            requires std::is_invocable_r_v<Task<T>, F, Args...>
+        constexpr auto spawn(F &&f, Args &&...args) {
+            const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
+            Task<T> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+            std::future<T> value{task.getReturnValue()};
+
+            this->spawnCoroutine(std::move(task.getCoroutine()));
+
+            return value;
+        }
+
+        template<typename T, typename F, typename... Args>
+            requires std::is_lvalue_reference_v<T> && std::is_invocable_r_v<Task<T &>, F, Args...>
+        constexpr auto spawn(F &&f, Args &&...args) {
+            const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
+            Task<T &> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+            std::future<T &> value{task.getReturnValue()};
+
+            this->spawnCoroutine(std::move(task.getCoroutine()));
+
+            return value;
+        }
+
+        template<typename F, typename... Args>
+            requires std::is_invocable_r_v<Task<>, F, Args...>
+        constexpr auto spawn(F &&f, Args &&...args) {
+            const internal::FrameMemoryResourceScope frameMemoryResourceScope{internal::getSyncMemoryResource()};
+            Task<> task{std::invoke(std::forward<F>(f), std::forward<Args>(args)...)};
+            std::future<void> value{task.getReturnValue()};
+
+            this->spawnCoroutine(std::move(task.getCoroutine()));
+
+            return value;
+        }
+
+    private:
+        auto spawnCoroutine(internal::Coroutine coroutine) -> void;
+
+        std::unique_ptr<internal::Scheduler> scheduler;
+        ContextOptions options;
+    };
+}    // namespace coContext
+
+template<>
+constexpr auto std::swap(coContext::Runtime &lhs, coContext::Runtime &rhs) noexcept -> void {
+    lhs.swap(rhs);
+}
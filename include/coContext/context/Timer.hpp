@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../coroutine/Coroutine.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+namespace coContext {
+    class CancellationScope;
+
+    namespace internal {
+        class TimerWheel;
+    }    // namespace internal
+
+    // timers fired, kernel timeouts and wheel timers alike, over the loop iterations that fired at least one; their
+    // ratio is the average number of expiries a wakeup handles
+    struct TimerStatistics {
+        std::uint64_t wakeupCount, timerCount;
+    };
+
+    // a timer on the current context's timer wheel, armed, reset and cancelled in constant time without a kernel
+    // timeout of its own; the wheel links the timer in place, so it must not outlive or leave its context while armed
+    class Timer {
+        friend CancellationScope;
+        friend internal::TimerWheel;
+
+    public:
+        Timer() noexcept = default;
+
+        Timer(const Timer &) = delete;
+
+        auto operator=(const Timer &) -> Timer & = delete;
+
+        Timer(Timer &&) noexcept = delete;
+
+        auto operator=(Timer &&) noexcept -> Timer & = delete;
+
+        ~Timer();
+
+        [[nodiscard]] auto isArmed() const noexcept -> bool;
+
+        [[nodiscard]] auto wait(std::chrono::nanoseconds duration) -> Timer &;
+
+        auto reset(std::chrono::nanoseconds duration) -> void;
+
+        auto cancel() -> void;
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool;
+
+        auto await_suspend(std::coroutine_handle<> genericCoroutineHandle) -> void;
+
+        [[nodiscard]] auto await_resume() const noexcept -> std::int32_t;
+
+    private:
+        auto expire(std::int32_t result) -> void;
+
+        Timer *previous{}, *next{};
+        std::uint64_t expiry{};
+        std::uint16_t slot{};
+        bool isLinked{};
+        std::int32_t result{};
+        internal::Coroutine::Handle coroutineHandle;
+        CancellationScope *cancellationScope{};
+    };
+}    // namespace coContext
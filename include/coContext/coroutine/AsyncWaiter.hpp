@@ -3,10 +3,14 @@
 #include "../ring/Submission.hpp"
 #include "Coroutine.hpp"
 
+#include <functional>
+
 namespace coContext::internal {
     class AsyncWaiter {
     public:
-        explicit AsyncWaiter(Submission submission) noexcept;
+        // the running scope's deadline is linked right behind a single-shot submission as it is taken, before anything
+        // else can be taken in between and join the chain
+        explicit AsyncWaiter(Submission submission);
 
         AsyncWaiter(const AsyncWaiter &) = delete;
 
@@ -22,9 +26,19 @@ namespace coContext::internal {
 
         [[nodiscard]] auto getSubmission() const noexcept -> Submission;
 
-        [[nodiscard]] auto getTimeSpecification() const noexcept -> const std::unique_ptr<__kernel_timespec> &;
+        // a link added behind a link timeout continues the chain from the timeout
+        auto addFlags(std::uint32_t flags) const noexcept -> void;
+
+        // kept inline and pointed to by the submission once the waiter is suspended at its final address
+        auto setTimeSpecification(__kernel_timespec timeSpecification) noexcept -> void;
+
+        // prepares the link timeout next to the submission, or keeps the earlier of it and the one already prepared
+        auto setLinkTimeout(__kernel_timespec timeSpecification, std::uint32_t flags) -> void;
+
+        auto setDirectAllocation() noexcept -> void;
 
-        auto setTimeSpecification(std::unique_ptr<__kernel_timespec> timeSpecification) noexcept -> void;
+        // routes the completions of a zero-copy send through a notification id, release runs on its notification
+        auto setNotification(std::move_only_function<auto()->void> release) -> void;
 
         [[nodiscard]] auto await_ready() const noexcept -> bool;
 
@@ -35,9 +49,12 @@ namespace coContext::internal {
         [[nodiscard]] auto getResumeFlags() const -> std::uint32_t;
 
     private:
-        Submission submission;
+        Submission submission, linkTimeout;
         Coroutine::Handle coroutineHandle;
-        std::unique_ptr<__kernel_timespec> timeSpecification;
+        __kernel_timespec timeSpecification{}, linkTimeSpecification{};
+        std::uint64_t notificationId{};
+        std::uint32_t linkTimeoutFlags{};
+        bool isTimeSpecification{}, isLinkTimeout{}, isDirectAllocation{}, isNotification{};
     };
 }    // namespace coContext::internal
 
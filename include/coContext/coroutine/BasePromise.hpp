@@ -3,11 +3,29 @@
 #include "../memory/memoryResource.hpp"
 #include "Coroutine.hpp"
 
-#include <memory>
+#include <cstddef>
+#include <exception>
+#include <limits>
+
+namespace coContext {
+    class CancellationScope;
+}    // namespace coContext
 
 namespace coContext::internal {
     class BasePromise {
+        class FinalAwaiter {
+        public:
+            [[nodiscard]] auto await_ready() const noexcept -> bool;
+
+            [[nodiscard]] auto await_suspend(std::coroutine_handle<> genericCoroutineHandle) const noexcept
+                -> std::coroutine_handle<>;
+
+            auto await_resume() const noexcept -> void;
+        };
+
     public:
+        static constexpr std::uint64_t invalidId{std::numeric_limits<std::uint64_t>::max()};
+
         [[nodiscard]] auto operator new(std::size_t) -> void *;
 
         auto operator delete(void *, std::size_t) noexcept -> void;
@@ -32,32 +50,42 @@ namespace coContext::internal {
 
         auto setFlags(std::uint32_t flags) noexcept -> void;
 
-        [[nodiscard]] auto getException() const noexcept -> const std::shared_ptr<std::exception_ptr> &;
+        [[nodiscard]] auto getException() const noexcept -> const std::exception_ptr &;
 
-        [[nodiscard]] auto getParentCoroutineId() const noexcept -> std::uint64_t;
+        [[nodiscard]] auto getId() const noexcept -> std::uint64_t;
 
-        auto setParentCoroutineId(std::uint64_t id) noexcept -> void;
+        auto setId(std::uint64_t id) noexcept -> void;
 
-        [[nodiscard]] auto getChildCoroutine() noexcept -> Coroutine &;
+        [[nodiscard]] auto getParentCoroutineHandle() const noexcept -> Coroutine::Handle;
 
-        auto setChildCoroutine(Coroutine coroutine) noexcept -> void;
+        auto setParentCoroutineHandle(Coroutine::Handle handle) noexcept -> void;
+
+        [[nodiscard]] auto getChildCoroutineHandle() const noexcept -> Coroutine::Handle;
+
+        auto setChildCoroutineHandle(Coroutine::Handle handle) noexcept -> void;
+
+        [[nodiscard]] auto getCancellationScope() const noexcept -> CancellationScope *;
+
+        auto setCancellationScope(CancellationScope *cancellationScope) noexcept -> void;
 
         [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always;
 
-        [[nodiscard]] auto final_suspend() const noexcept -> std::suspend_always;
+        [[nodiscard]] auto final_suspend() const noexcept -> FinalAwaiter;
 
-        auto unhandled_exception() const noexcept -> void;
+        auto unhandled_exception() noexcept -> void;
 
     protected:
         constexpr BasePromise() = default;
 
     private:
+        static constexpr std::size_t headerSize{alignof(std::max_align_t)};
+
         std::int32_t result{};
         std::uint32_t flags{};
-        std::shared_ptr<std::exception_ptr> exception{std::allocate_shared<std::exception_ptr>(
-            std::pmr::polymorphic_allocator<std::exception_ptr>{getUnsyncMemoryResource()})};
-        std::uint64_t parentCoroutineId{std::hash<Coroutine>{}(Coroutine{nullptr})};
-        Coroutine childCoroutine{nullptr};
+        std::exception_ptr exception;
+        std::uint64_t id{invalidId};
+        Coroutine::Handle parentCoroutineHandle, childCoroutineHandle;
+        CancellationScope *cancellationScope{};
     };
 }    // namespace coContext::internal
 
@@ -2,8 +2,6 @@
 
 #include "Coroutine.hpp"
 
-#include <memory>
-
 namespace coContext::internal {
     class BaseTask {
     public:
@@ -25,14 +23,14 @@ namespace coContext::internal {
 
         [[nodiscard]] auto await_ready() const noexcept -> bool;
 
-        auto await_suspend(std::coroutine_handle<> genericCoroutineHandle) -> void;
+        [[nodiscard]] auto await_suspend(std::coroutine_handle<> genericCoroutineHandle) const noexcept
+            -> std::coroutine_handle<>;
 
     protected:
-        BaseTask(Coroutine coroutine, std::shared_ptr<std::exception_ptr> exception) noexcept;
+        explicit BaseTask(Coroutine coroutine) noexcept;
 
     private:
         Coroutine coroutine;
-        std::shared_ptr<std::exception_ptr> exception;
     };
 }    // namespace coContext::internal
 
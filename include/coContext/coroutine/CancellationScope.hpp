@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../memory/memoryResource.hpp"
+#include "Task.hpp"
+
+#include <chrono>
+#include <linux/time_types.h>
+#include <optional>
+#include <vector>
+
+namespace coContext {
+    class Timer;
+
+    namespace internal {
+        class AsyncWaiter;
+        class BaseTask;
+    }    // namespace internal
+
+    // a task run inside a scope passes the scope on to every task it awaits; each single-shot submission of that
+    // subtree gets the scope's deadline as a link timeout, and cancel() cancels all of them at once and wakes its
+    // Timer waits with -ECANCELED, a scope opened inside another scope is bounded by the outer deadline and cancelled
+    // with it; SendQueue writes are not covered, a partly sent write cannot be taken back from the stream
+    class CancellationScope {
+        friend Timer;
+        friend internal::AsyncWaiter;
+        friend internal::BaseTask;
+
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        CancellationScope() noexcept = default;
+
+        explicit CancellationScope(std::chrono::nanoseconds timeout);
+
+        explicit CancellationScope(Clock::time_point deadline) noexcept;
+
+        CancellationScope(const CancellationScope &) = delete;
+
+        auto operator=(const CancellationScope &) -> CancellationScope & = delete;
+
+        CancellationScope(CancellationScope &&) noexcept = delete;
+
+        auto operator=(CancellationScope &&) noexcept -> CancellationScope & = delete;
+
+        ~CancellationScope();
+
+        template<internal::Returnable T>
+        [[nodiscard]] auto operator()(Task<T> task) -> Task<T> {
+            task.getCoroutine().getPromise().setCancellationScope(this);
+
+            return task;
+        }
+
+        [[nodiscard]] auto getDeadline() const noexcept -> Clock::time_point;
+
+        [[nodiscard]] auto isCancelled() const noexcept -> bool;
+
+        auto cancel() -> void;
+
+    private:
+        [[nodiscard]] auto getParent() const noexcept -> CancellationScope *;
+
+        auto setParent(CancellationScope *parent) noexcept -> void;
+
+        [[nodiscard]] auto getLinkTimeout() const noexcept -> std::optional<__kernel_timespec>;
+
+        auto track(std::uint64_t id) -> void;
+
+        auto track(Timer &timer) -> void;
+
+        auto untrack(Timer &timer) noexcept -> void;
+
+        std::pmr::vector<std::uint64_t> ids{internal::getUnsyncMemoryResource()};
+        std::pmr::vector<Timer *> timers{internal::getUnsyncMemoryResource()};
+        Clock::time_point deadline{Clock::time_point::max()};
+        CancellationScope *parent{};
+        bool isCancelRequested{};
+    };
+}    // namespace coContext
@@ -25,6 +25,8 @@ namespace coContext::internal {
 
         [[nodiscard]] auto get() const noexcept -> Handle;
 
+        [[nodiscard]] auto release() noexcept -> Handle;
+
         explicit operator bool() const noexcept;
 
         [[nodiscard]] auto getPromise() const -> BasePromise &;
@@ -1,16 +1,16 @@
 #pragma once
 
 #include <cstdint>
-#include <functional>
+#include <linux/time_types.h>
 
 namespace coContext::internal {
     class AsyncWaiter;
 
     class Marker {
-        using Action = std::function<auto()->void>;
-
     public:
-        explicit Marker(std::uint32_t flags = {}, Action action = {}) noexcept;
+        explicit Marker(std::uint32_t flags = {}) noexcept;
+
+        Marker(std::uint32_t flags, __kernel_timespec timeSpecification, std::uint32_t timeoutFlags) noexcept;
 
         Marker(const Marker &) = default;
 
@@ -26,20 +26,23 @@ namespace coContext::internal {
 
         [[nodiscard]] auto getFlags() const noexcept -> std::uint32_t;
 
-        [[nodiscard]] auto getAction() noexcept -> Action &;
-
         auto addFlags(std::uint32_t flags) noexcept -> void;
 
-        auto setAction(Action action) noexcept -> void;
+        [[nodiscard]] auto hasLinkTimeout() const noexcept -> bool;
+
+        [[nodiscard]] auto getTimeSpecification() const noexcept -> __kernel_timespec;
+
+        [[nodiscard]] auto getTimeoutFlags() const noexcept -> std::uint32_t;
 
-        auto executeAction() const -> void;
+        auto setLinkTimeout(__kernel_timespec timeSpecification, std::uint32_t timeoutFlags) noexcept -> void;
 
     private:
-        std::uint32_t flags;
-        Action action;
+        __kernel_timespec timeSpecification{};
+        std::uint32_t flags, timeoutFlags{};
+        bool isLinkTimeout{};
     };
 
-    [[nodiscard]] auto operator|(Marker, Marker) noexcept -> Marker;
+    [[nodiscard]] auto operator|(Marker, const Marker &) noexcept -> Marker;
 
     [[nodiscard]] auto operator|(AsyncWaiter, const Marker &) -> AsyncWaiter;
 }    // namespace coContext::internal
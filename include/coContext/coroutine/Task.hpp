@@ -4,6 +4,7 @@
 #include "BaseTask.hpp"
 
 #include <future>
+#include <optional>
 
 namespace coContext {
     namespace internal {
@@ -33,6 +34,7 @@ namespace coContext {
 
             constexpr auto swap(Promise &other) noexcept {
                 std::swap(static_cast<BasePromise &>(*this), static_cast<BasePromise &>(other));
+                std::swap(this->value, other.value);
                 std::swap(this->returnValue, other.returnValue);
             }
 
@@ -41,13 +43,17 @@ namespace coContext {
             template<typename... Args>
                 requires std::constructible_from<T, Args...>
             constexpr auto return_value(Args &&...args) {
-                this->returnValue.set_value(T{std::forward<Args>(args)...});
+                if (this->returnValue) this->returnValue->set_value(T{std::forward<Args>(args)...});
+                else this->value.emplace(std::forward<Args>(args)...);
             }
 
-            [[nodiscard]] constexpr auto getReturnValue() { return this->returnValue.get_future(); }
+            [[nodiscard]] constexpr auto getReturnValue() { return this->returnValue.emplace().get_future(); }
+
+            [[nodiscard]] constexpr auto getValue() -> T { return std::move(*this->value); }
 
         private:
-            std::promise<T> returnValue;
+            std::optional<T> value;
+            std::optional<std::promise<T>> returnValue;
         };
 
     public:
@@ -65,24 +71,25 @@ namespace coContext {
 
         constexpr auto swap(Task &other) noexcept {
             std::swap(static_cast<BaseTask &>(*this), static_cast<BaseTask &>(other));
-            std::swap(this->returnValue, other.returnValue);
+            std::swap(this->coroutineHandle, other.coroutineHandle);
         }
 
-        [[nodiscard]] constexpr auto getReturnValue() noexcept -> std::future<T> & { return this->returnValue; }
+        [[nodiscard]] constexpr auto getReturnValue() -> std::future<T> {
+            return this->coroutineHandle.promise().getReturnValue();
+        }
 
-        [[nodiscard]] constexpr auto await_resume() {
+        [[nodiscard]] constexpr auto await_resume() -> T {
             this->throwException();
 
-            return this->returnValue.get();
+            return this->coroutineHandle.promise().getValue();
         }
 
     private:
         explicit constexpr Task(const CoroutineHandle coroutineHandle) :
-            BaseTask{internal::Coroutine{internal::Coroutine::Handle::from_address(coroutineHandle.address())},
-                     coroutineHandle.promise().getException()},
-            returnValue{coroutineHandle.promise().getReturnValue()} {}
+            BaseTask{internal::Coroutine{internal::Coroutine::Handle::from_address(coroutineHandle.address())}},
+            coroutineHandle{coroutineHandle} {}
 
-        std::future<T> returnValue;
+        CoroutineHandle coroutineHandle;
     };
 
     template<typename T>
@@ -107,17 +114,24 @@ namespace coContext {
 
             constexpr auto swap(Promise &other) noexcept {
                 std::swap(static_cast<BasePromise &>(*this), static_cast<BasePromise &>(other));
+                std::swap(this->value, other.value);
                 std::swap(this->returnValue, other.returnValue);
             }
 
             [[nodiscard]] constexpr auto get_return_object() { return Task{CoroutineHandle::from_promise(*this)}; }
 
-            constexpr auto return_value(T &returnValue) { this->returnValue.set_value(returnValue); }
+            constexpr auto return_value(T &value) {
+                if (this->returnValue) this->returnValue->set_value(value);
+                else this->value = std::addressof(value);
+            }
+
+            [[nodiscard]] constexpr auto getReturnValue() { return this->returnValue.emplace().get_future(); }
 
-            [[nodiscard]] constexpr auto getReturnValue() { return this->returnValue.get_future(); }
+            [[nodiscard]] constexpr auto getValue() const noexcept -> T & { return *this->value; }
 
         private:
-            std::promise<T &> returnValue;
+            T *value{};
+            std::optional<std::promise<T &>> returnValue;
         };
 
     public:
@@ -135,24 +149,25 @@ namespace coContext {
 
         constexpr auto swap(Task &other) noexcept {
             std::swap(static_cast<BaseTask &>(*this), static_cast<BaseTask &>(other));
-            std::swap(this->returnValue, other.returnValue);
+            std::swap(this->coroutineHandle, other.coroutineHandle);
         }
 
-        [[nodiscard]] constexpr auto getReturnValue() noexcept -> std::future<T &> & { return this->returnValue; }
+        [[nodiscard]] constexpr auto getReturnValue() -> std::future<T &> {
+            return this->coroutineHandle.promise().getReturnValue();
+        }
 
         [[nodiscard]] constexpr auto await_resume() -> T & {
             this->throwException();
 
-            return this->returnValue.get();
+            return this->coroutineHandle.promise().getValue();
         }
 
     private:
         explicit constexpr Task(const CoroutineHandle coroutineHandle) :
-            BaseTask{internal::Coroutine{internal::Coroutine::Handle::from_address(coroutineHandle.address())},
-                     coroutineHandle.promise().getException()},
-            returnValue{coroutineHandle.promise().getReturnValue()} {}
+            BaseTask{internal::Coroutine{internal::Coroutine::Handle::from_address(coroutineHandle.address())}},
+            coroutineHandle{coroutineHandle} {}
 
-        std::future<T &> returnValue;
+        CoroutineHandle coroutineHandle;
     };
 
     template<>
@@ -182,12 +197,14 @@ namespace coContext {
 
             [[nodiscard]] constexpr auto get_return_object() { return Task{CoroutineHandle::from_promise(*this)}; }
 
-            constexpr auto return_void() { this->returnValue.set_value(); }
+            constexpr auto return_void() {
+                if (this->returnValue) this->returnValue->set_value();
+            }
 
-            [[nodiscard]] constexpr auto getReturnValue() { return this->returnValue.get_future(); }
+            [[nodiscard]] constexpr auto getReturnValue() { return this->returnValue.emplace().get_future(); }
 
         private:
-            std::promise<void> returnValue;
+            std::optional<std::promise<void>> returnValue;
         };
 
     public:
@@ -205,20 +222,21 @@ namespace coContext {
 
         constexpr auto swap(Task &other) noexcept {
             std::swap(static_cast<BaseTask &>(*this), static_cast<BaseTask &>(other));
-            std::swap(this->returnValue, other.returnValue);
+            std::swap(this->coroutineHandle, other.coroutineHandle);
         }
 
-        [[nodiscard]] constexpr auto getReturnValue() noexcept -> std::future<void> & { return this->returnValue; }
+        [[nodiscard]] constexpr auto getReturnValue() -> std::future<void> {
+            return this->coroutineHandle.promise().getReturnValue();
+        }
 
         constexpr auto await_resume() const { this->throwException(); }
 
     private:
         explicit constexpr Task(const CoroutineHandle coroutineHandle) :
-            BaseTask{internal::Coroutine{internal::Coroutine::Handle::from_address(coroutineHandle.address())},
-                     coroutineHandle.promise().getException()},
-            returnValue{coroutineHandle.promise().getReturnValue()} {}
+            BaseTask{internal::Coroutine{internal::Coroutine::Handle::from_address(coroutineHandle.address())}},
+            coroutineHandle{coroutineHandle} {}
 
-        std::future<void> returnValue;
+        CoroutineHandle coroutineHandle;
     };
 }    // namespace coContext
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../context/Clock.hpp"
 #include "../memory/memoryResource.hpp"
 
 #include <chrono>
@@ -15,7 +16,7 @@ namespace coContext {
         explicit Log(Level level = Level::info,
                      std::pmr::string message = std::pmr::string{internal::getSyncMemoryResource()},
                      std::source_location sourceLocation = std::source_location::current(),
-                     std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now(),
+                     std::chrono::system_clock::time_point timestamp = wallNow(),
                      std::thread::id threadId = std::this_thread::get_id());
 
         auto swap(Log &other) noexcept -> void;
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+namespace coContext::frame {
+    struct Statistics {
+        std::size_t liveFrames, liveBytes, peakLiveFrames, peakLiveBytes, reservedBytes;
+    };
+
+    [[nodiscard]] auto getStatistics() -> Statistics;
+
+    // frame memory only grows, reservedBytes stays at the thread's peak until it exits; huge pages, also selectable
+    // through ContextOptions::isHugePageFrame, apply to the arenas reserved from then on
+    auto enableHugePage() -> void;
+
+    auto disableHugePage() -> void;
+}    // namespace coContext::frame
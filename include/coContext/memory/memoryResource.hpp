@@ -6,4 +6,27 @@ namespace coContext::internal {
     [[nodiscard]] auto getSyncMemoryResource() -> std::pmr::memory_resource *;
 
     [[nodiscard]] auto getUnsyncMemoryResource() -> std::pmr::memory_resource *;
+
+    [[nodiscard]] auto getFrameMemoryResource() -> std::pmr::memory_resource *;
+
+    auto setFrameMemoryResource(std::pmr::memory_resource *resource) noexcept -> void;
+
+    // allocates the frames created in its lifetime from a resource and restores the previous one however it is left
+    class FrameMemoryResourceScope {
+    public:
+        explicit FrameMemoryResourceScope(std::pmr::memory_resource *resource) noexcept;
+
+        FrameMemoryResourceScope(const FrameMemoryResourceScope &) = delete;
+
+        auto operator=(const FrameMemoryResourceScope &) -> FrameMemoryResourceScope & = delete;
+
+        FrameMemoryResourceScope(FrameMemoryResourceScope &&) noexcept = delete;
+
+        auto operator=(FrameMemoryResourceScope &&) noexcept -> FrameMemoryResourceScope & = delete;
+
+        ~FrameMemoryResourceScope();
+
+    private:
+        std::pmr::memory_resource *previousResource;
+    };
 }    // namespace coContext::internal
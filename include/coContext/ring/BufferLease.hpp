@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace coContext {
+    namespace internal {
+        class BufferRing;
+    }    // namespace internal
+
+    class BufferLease {
+    public:
+        BufferLease() noexcept = default;
+
+        BufferLease(internal::BufferRing *bufferRing, std::uint16_t bufferId, std::span<const std::byte> data) noexcept;
+
+        BufferLease(const BufferLease &other) noexcept;
+
+        auto operator=(const BufferLease &other) noexcept -> BufferLease &;
+
+        BufferLease(BufferLease &&other) noexcept;
+
+        auto operator=(BufferLease &&other) noexcept -> BufferLease &;
+
+        ~BufferLease();
+
+        auto swap(BufferLease &other) noexcept -> void;
+
+        [[nodiscard]] auto getData() const noexcept -> std::span<const std::byte>;
+
+        auto reset() noexcept -> void;
+
+    private:
+        internal::BufferRing *bufferRing{};
+        std::uint16_t bufferId{};
+        std::span<const std::byte> data;
+    };
+}    // namespace coContext
+
+template<>
+constexpr auto std::swap(coContext::BufferLease &lhs, coContext::BufferLease &rhs) noexcept -> void { lhs.swap(rhs); }
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace coContext {
+    struct BufferPolicy {
+        std::uint32_t lowWatermark{64}, highWatermark{std::numeric_limits<std::uint32_t>::max()};
+        std::chrono::milliseconds idleTime{std::chrono::seconds{30}};
+    };
+
+    struct BufferStatistics {
+        std::uint32_t bufferCount;
+        std::uint64_t noBufferCount, growCount, shrinkCount;
+    };
+}    // namespace coContext
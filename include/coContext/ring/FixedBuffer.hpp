@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace coContext {
+    struct FixedBuffer {
+        std::span<std::byte> data;
+        std::uint32_t index;
+    };
+}    // namespace coContext
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "BufferLease.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace coContext {
+    struct ReceivedMessage {
+        BufferLease lease;
+        std::span<const std::byte> address, control, payload;
+        std::uint32_t payloadSize, flags;
+    };
+}    // namespace coContext
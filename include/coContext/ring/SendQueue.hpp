@@ -0,0 +1,89 @@
+#pragma once
+
+#include "../coroutine/Marker.hpp"
+#include "../coroutine/Task.hpp"
+#include "../memory/memoryResource.hpp"
+
+#include <climits>
+#include <memory>
+#include <span>
+#include <sys/uio.h>
+#include <vector>
+
+namespace coContext {
+    // serializes the writes of one socket and coalesces the ones queued in the same loop iteration into one sendmsg;
+    // awaiting an empty send drains it, destroying it cancels the send in flight and fails the writes still queued with
+    // -ECANCELED; a CancellationScope does not reach its writes, shutting the socket down fails them
+    class SendQueue {
+        struct Writer {
+            std::span<const std::byte> data;
+            std::size_t sentSize;
+            internal::Coroutine::Handle coroutineHandle;
+        };
+
+        // shared with the flush coroutine, which finishes after the queue when it is destroyed with writes queued
+        struct State {
+            std::pmr::vector<Writer> writers{internal::getUnsyncMemoryResource()};
+            std::pmr::vector<iovec> vectors{internal::getUnsyncMemoryResource()};
+            std::size_t head{};
+            std::uint64_t flushId{};
+            std::int32_t socketFileDescriptor{}, flags{};
+            internal::Marker marker;
+            bool isFlushing{}, isClosed{};
+        };
+
+    public:
+        class Waiter {
+        public:
+            Waiter(SendQueue &sendQueue, std::span<const std::byte> data) noexcept;
+
+            [[nodiscard]] auto await_ready() const noexcept -> bool;
+
+            auto await_suspend(std::coroutine_handle<> genericCoroutineHandle) -> void;
+
+            [[nodiscard]] auto await_resume() const noexcept -> std::int32_t;
+
+        private:
+            SendQueue &sendQueue;
+            std::span<const std::byte> data;
+            internal::Coroutine::Handle coroutineHandle;
+        };
+
+        explicit SendQueue(std::int32_t socketFileDescriptor, std::int32_t flags = {},
+                           internal::Marker marker = internal::Marker{});
+
+        SendQueue(const SendQueue &) = delete;
+
+        auto operator=(const SendQueue &) -> SendQueue & = delete;
+
+        SendQueue(SendQueue &&) noexcept = delete;
+
+        auto operator=(SendQueue &&) noexcept -> SendQueue & = delete;
+
+        ~SendQueue();
+
+        [[nodiscard]] auto send(std::span<const std::byte> data) noexcept -> Waiter;
+
+        // nobody is woken when a posted write completes, so data must stay alive until the queue drains or is destroyed
+        auto post(std::span<const std::byte> data) -> void;
+
+        [[nodiscard]] auto getPendingSize() const noexcept -> std::size_t;
+
+    private:
+        auto enqueue(std::span<const std::byte> data, internal::Coroutine::Handle coroutineHandle) -> void;
+
+        [[nodiscard]] static auto flush(std::shared_ptr<State> state) -> Task<>;
+
+        [[nodiscard]] static auto getPendingSize(const State &state) noexcept -> std::size_t;
+
+        static auto completeWriters(State &state, std::size_t size) -> void;
+
+        static auto failWriters(State &state, std::int32_t result) -> void;
+
+        static auto wake(const Writer &writer, std::int32_t result) -> void;
+
+        static constexpr std::size_t maxVectorCount{IOV_MAX};
+
+        std::shared_ptr<State> state;
+    };
+}    // namespace coContext
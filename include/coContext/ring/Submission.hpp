@@ -11,6 +11,10 @@ namespace coContext::internal {
 
         [[nodiscard]] static auto noOperation(io_uring_sqe *handle) noexcept -> Submission;
 
+        [[nodiscard]] static auto messageRing(io_uring_sqe *handle, std::int32_t ringFileDescriptor,
+                                              std::uint32_t result, std::uint64_t userData,
+                                              std::uint32_t completionFlags) noexcept -> Submission;
+
         [[nodiscard]] static auto cancel(io_uring_sqe *handle, std::uint64_t userData, std::int32_t flags) noexcept
             -> Submission;
 
@@ -95,6 +99,9 @@ namespace coContext::internal {
                                                   std::span<std::byte> buffer, std::int32_t flags) noexcept
             -> Submission;
 
+        [[nodiscard]] static auto multipleReceive(io_uring_sqe *handle, std::int32_t socketFileDescriptor,
+                                                  msghdr *message, std::uint32_t flags) noexcept -> Submission;
+
         [[nodiscard]] static auto send(io_uring_sqe *handle, std::int32_t socketFileDescriptor,
                                        std::span<const std::byte> buffer, std::int32_t flags) noexcept -> Submission;
 
@@ -106,6 +113,10 @@ namespace coContext::internal {
         [[nodiscard]] static auto send(io_uring_sqe *handle, std::int32_t socketFileDescriptor, const msghdr *message,
                                        std::uint32_t flags) noexcept -> Submission;
 
+        [[nodiscard]] static auto sendFixed(io_uring_sqe *handle, std::int32_t socketFileDescriptor,
+                                            std::span<const std::byte> buffer, std::int32_t flags,
+                                            std::uint32_t bufferIndex) noexcept -> Submission;
+
         [[nodiscard]] static auto zeroCopySend(io_uring_sqe *handle, std::int32_t socketFileDescriptor,
                                                std::span<const std::byte> buffer, std::int32_t flags,
                                                std::uint32_t zeroCopyFlags) noexcept -> Submission;
@@ -113,6 +124,11 @@ namespace coContext::internal {
         [[nodiscard]] static auto zeroCopySend(io_uring_sqe *handle, std::int32_t socketFileDescriptor,
                                                const msghdr *message, std::uint32_t flags) noexcept -> Submission;
 
+        [[nodiscard]] static auto zeroCopySendFixed(io_uring_sqe *handle, std::int32_t socketFileDescriptor,
+                                                    std::span<const std::byte> buffer, std::int32_t flags,
+                                                    std::uint32_t zeroCopyFlags, std::uint32_t bufferIndex) noexcept
+            -> Submission;
+
         [[nodiscard]] static auto splice(io_uring_sqe *handle, std::int32_t inFileDescriptor, std::int64_t inOffset,
                                          std::int32_t outFileDescriptor, std::int64_t outOffset, std::uint32_t length,
                                          std::uint32_t flags) noexcept -> Submission;
@@ -152,6 +168,10 @@ namespace coContext::internal {
         [[nodiscard]] static auto read(io_uring_sqe *handle, std::int32_t fileDescriptor, std::span<const iovec> buffer,
                                        std::uint64_t offset, std::int32_t flags) noexcept -> Submission;
 
+        [[nodiscard]] static auto readFixed(io_uring_sqe *handle, std::int32_t fileDescriptor,
+                                            std::span<std::byte> buffer, std::uint64_t offset,
+                                            std::int32_t bufferIndex) noexcept -> Submission;
+
         [[nodiscard]] static auto multipleRead(io_uring_sqe *handle, std::int32_t fileDescriptor, std::uint32_t length,
                                                std::uint64_t offset, std::int32_t bufferGroup) noexcept -> Submission;
 
@@ -165,6 +185,10 @@ namespace coContext::internal {
                                         std::span<const iovec> buffer, std::uint64_t offset,
                                         std::int32_t flags) noexcept -> Submission;
 
+        [[nodiscard]] static auto writeFixed(io_uring_sqe *handle, std::int32_t fileDescriptor,
+                                             std::span<const std::byte> buffer, std::uint64_t offset,
+                                             std::int32_t bufferIndex) noexcept -> Submission;
+
         [[nodiscard]] static auto syncFile(io_uring_sqe *handle, std::int32_t fileDescriptor,
                                            std::uint32_t flags) noexcept -> Submission;
 
@@ -263,6 +287,13 @@ namespace coContext::internal {
 
         auto setBufferGroup(std::int32_t bufferGroup) const noexcept -> void;
 
+        auto setTimeSpecification(const __kernel_timespec *timeSpecification) const noexcept -> void;
+
+        auto setTimeoutFlags(std::uint32_t flags) const noexcept -> void;
+
+        // whether the request completes once and only on its own behalf, neither multishot nor acting on other requests
+        [[nodiscard]] auto isSingleShot() const noexcept -> bool;
+
     private:
         io_uring_sqe *handle;
     };
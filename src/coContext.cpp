@@ -3,6 +3,9 @@
 #include "context/Context.hpp"
 #include "log/Exception.hpp"
 
+#include <algorithm>
+#include <ctime>
+
 namespace {
     thread_local coContext::internal::Context context;
 
@@ -25,24 +28,131 @@ namespace {
         return flags;
     }
 
+    struct CoalescedTimeout {
+        __kernel_timespec timeSpecification;
+        std::uint32_t flags;
+    };
+
+    // turns a relative expiry into an absolute one on the same clock before rounding it, an absolute one already is
+    [[nodiscard]] auto coalesceTimeout(const std::chrono::seconds seconds, const std::chrono::nanoseconds nanoseconds,
+                                       const coContext::ClockSource clockSource, const std::chrono::nanoseconds slack)
+        -> CoalescedTimeout {
+        if (slack <= std::chrono::nanoseconds::zero()) {
+            return CoalescedTimeout{__kernel_timespec{seconds.count(), nanoseconds.count()},
+                                    setClockSource(clockSource)};
+        }
+
+        // the cached clocks, the boot clock aside which has none and is read directly; the coarse wall clock lags by up
+        // to a tick, well inside any slack worth coalescing on
+        std::chrono::nanoseconds expiry{seconds + nanoseconds};
+        switch (clockSource) {
+            case coContext::ClockSource::monotonic:
+                expiry += coContext::now().time_since_epoch();
+                break;
+            case coContext::ClockSource::absolute:
+                break;
+            case coContext::ClockSource::boot: {
+                timespec now{};
+                clock_gettime(CLOCK_BOOTTIME, std::addressof(now));
+                expiry += std::chrono::seconds{now.tv_sec} + std::chrono::nanoseconds{now.tv_nsec};
+                break;
+            }
+            case coContext::ClockSource::real:
+                expiry += coContext::wallNow().time_since_epoch();
+                break;
+        }
+        expiry = (expiry + slack - std::chrono::nanoseconds{1}) / slack * slack;
+
+        return CoalescedTimeout{
+            __kernel_timespec{std::chrono::duration_cast<std::chrono::seconds>(expiry).count(),
+                              (expiry % std::chrono::seconds{1}).count()},
+            setClockSource(clockSource) | IORING_TIMEOUT_ABS
+        };
+    }
+
+    [[nodiscard]] constexpr auto selectBufferRing(const coContext::BufferGroup bufferGroup) noexcept
+        -> coContext::internal::BufferRing & {
+        return bufferGroup == coContext::BufferGroup::automatic ?
+                   context.selectBufferRing() :
+                   context.getBufferRing(static_cast<std::size_t>(bufferGroup) - 1);
+    }
+
+    [[nodiscard]] auto parseMessage(const std::span<const std::byte> data, msghdr &message,
+                                    coContext::ReceivedMessage &receivedMessage) noexcept -> std::int32_t {
+        io_uring_recvmsg_out *const out{io_uring_recvmsg_validate(
+            const_cast<std::byte *>(std::data(data)), static_cast<std::int32_t>(std::size(data)), &message)};
+        if (out == nullptr) return -EBADMSG;
+
+        const auto name{static_cast<const std::byte *>(io_uring_recvmsg_name(out))};
+        receivedMessage.address = std::span{name, std::min<std::size_t>(out->namelen, message.msg_namelen)};
+        receivedMessage.control =
+            std::span{name + message.msg_namelen, std::min<std::size_t>(out->controllen, message.msg_controllen)};
+        receivedMessage.payload =
+            std::span{static_cast<const std::byte *>(io_uring_recvmsg_payload(out, &message)),
+                      io_uring_recvmsg_payload_length(out, static_cast<std::int32_t>(std::size(data)), &message)};
+        receivedMessage.payloadSize = out->payloadlen;
+        receivedMessage.flags = out->flags;
+
+        return static_cast<std::int32_t>(std::size(receivedMessage.payload));
+    }
+
     [[nodiscard]] constexpr auto rawSleep(const std::chrono::seconds seconds,
                                           const std::chrono::nanoseconds nanoseconds, const std::uint32_t flags) {
-        auto timeSpecification{std::make_unique<__kernel_timespec>(seconds.count(), nanoseconds.count())};
-
         coContext::internal::AsyncWaiter asyncWaiter{
-            coContext::internal::Submission::timeout(context.getSubmission(), timeSpecification.get(), 0, flags)};
-        asyncWaiter.setTimeSpecification(std::move(timeSpecification));
+            coContext::internal::Submission::timeout(context.getSubmission(), nullptr, 0, flags)};
+        asyncWaiter.setTimeSpecification(__kernel_timespec{seconds.count(), nanoseconds.count()});
 
         return asyncWaiter;
     }
 }    // namespace
 
-auto coContext::internal::spawn(Coroutine coroutine) -> void { context.spawn(std::move(coroutine)); }
+auto coContext::internal::getContext() -> Context & { return context; }
+
+auto coContext::internal::spawn(Coroutine coroutine) -> std::uint64_t {
+    return context.spawnBalanced(std::move(coroutine));
+}
+
+auto coContext::internal::spawnOn(const std::uint32_t contextId, Coroutine coroutine) -> void {
+    context.spawnOn(contextId, std::move(coroutine));
+}
+
+auto coContext::internal::run(Scheduler &scheduler, const std::uint32_t index, const ContextOptions &options) -> void {
+    context.configure(options);
+    context.attach(std::addressof(scheduler), index);
+
+    try {
+        context.run();
+    } catch (...) {
+        context.attach(nullptr, 0);
+
+        throw;
+    }
+
+    context.attach(nullptr, 0);
+}
+
+auto coContext::configure(const ContextOptions &options) -> void { context.configure(options); }
+
+auto coContext::getBufferStatistics(const BufferGroup bufferGroup) -> BufferStatistics {
+    return selectBufferRing(bufferGroup).getStatistics();
+}
+
+auto coContext::getTimerStatistics() -> TimerStatistics { return context.getTimerStatistics(); }
+
+auto coContext::allocateFixedBuffer(const std::size_t size) -> FixedBuffer {
+    return context.getFixedBufferPool().allocate(size);
+}
+
+auto coContext::releaseFixedBuffer(const FixedBuffer buffer) -> void { context.getFixedBufferPool().release(buffer); }
+
+auto coContext::getRingFileDescriptor() -> std::int32_t { return context.getRingFileDescriptor(); }
 
 auto coContext::run() -> void { context.run(); }
 
 auto coContext::stop() -> void { context.stop(); }
 
+auto coContext::getContextId() -> std::uint32_t { return context.getId(); }
+
 auto coContext::syncCancel(const std::uint64_t taskId, const std::chrono::seconds seconds,
                            const std::chrono::nanoseconds nanoseconds) -> std::int32_t {
     return context.syncCancel(taskId, 0, __kernel_timespec{seconds.count(), nanoseconds.count()});
@@ -65,19 +175,10 @@ auto coContext::none() noexcept -> internal::Marker { return internal::Marker{};
 auto coContext::direct() noexcept -> internal::Marker { return internal::Marker{IOSQE_FIXED_FILE}; }
 
 auto coContext::timeout(const std::chrono::seconds seconds, const std::chrono::nanoseconds nanoseconds,
-                        const ClockSource clockSource) -> internal::Marker {
-    return internal::Marker{IOSQE_IO_LINK, [seconds, nanoseconds, clockSource] constexpr {
-                                spawn([seconds, nanoseconds, clockSource] -> Task<> {
-                                    auto timeSpecification{
-                                        std::make_unique<__kernel_timespec>(seconds.count(), nanoseconds.count())};
-
-                                    internal::AsyncWaiter asyncWaiter{internal::Submission::linkTimeout(
-                                        context.getSubmission(), timeSpecification.get(), setClockSource(clockSource))};
-                                    asyncWaiter.setTimeSpecification(std::move(timeSpecification));
+                        const ClockSource clockSource, const std::chrono::nanoseconds slack) -> internal::Marker {
+    const auto [timeSpecification, flags]{coalesceTimeout(seconds, nanoseconds, clockSource, slack)};
 
-                                    co_await asyncWaiter;
-                                });
-                            }};
+    return internal::Marker{IOSQE_IO_LINK, timeSpecification, flags};
 }
 
 auto coContext::noOperation() -> internal::AsyncWaiter {
@@ -99,18 +200,19 @@ auto coContext::cancelAny() -> internal::AsyncWaiter {
 }
 
 auto coContext::sleep(const std::chrono::seconds seconds, const std::chrono::nanoseconds nanoseconds,
-                      const ClockSource clockSource) -> internal::AsyncWaiter {
-    return rawSleep(seconds, nanoseconds, setClockSource(clockSource));
+                      const ClockSource clockSource, const std::chrono::nanoseconds slack) -> internal::AsyncWaiter {
+    const auto [timeSpecification, flags]{coalesceTimeout(seconds, nanoseconds, clockSource, slack)};
+
+    return rawSleep(std::chrono::seconds{timeSpecification.tv_sec}, std::chrono::nanoseconds{timeSpecification.tv_nsec},
+                    flags);
 }
 
 auto coContext::updateSleep(const std::uint64_t taskId, const std::chrono::seconds seconds,
                             const std::chrono::nanoseconds nanoseconds, const ClockSource clockSource)
     -> internal::AsyncWaiter {
-    auto timeSpecification{std::make_unique<__kernel_timespec>(seconds.count(), nanoseconds.count())};
-
-    internal::AsyncWaiter asyncWaiter{internal::Submission::updateTimeout(
-        context.getSubmission(), taskId, timeSpecification.get(), setClockSource(clockSource))};
-    asyncWaiter.setTimeSpecification(std::move(timeSpecification));
+    internal::AsyncWaiter asyncWaiter{
+        internal::Submission::updateTimeout(context.getSubmission(), taskId, nullptr, setClockSource(clockSource))};
+    asyncWaiter.setTimeSpecification(__kernel_timespec{seconds.count(), nanoseconds.count()});
 
     return asyncWaiter;
 }
@@ -146,8 +248,11 @@ auto coContext::multiplePoll(std::move_only_function<auto(std::int32_t)->Task<>>
 }
 
 auto coContext::toDirect(const std::span<std::int32_t> fileDescriptors) -> internal::AsyncWaiter {
-    return internal::AsyncWaiter{
+    internal::AsyncWaiter asyncWaiter{
         internal::Submission::updateFileDescriptors(context.getSubmission(), fileDescriptors, IORING_FILE_INDEX_ALLOC)};
+    asyncWaiter.setDirectAllocation();
+
+    return asyncWaiter;
 }
 
 auto coContext::installDirect(const std::int32_t directFileDescriptor, const bool isCloseOnExecute)
@@ -234,7 +339,10 @@ auto coContext::acceptDirect(const std::int32_t socketFileDescriptor, sockaddr *
         context.getSubmission(), socketFileDescriptor, address, addressLength, flags, IORING_FILE_INDEX_ALLOC)};
     submission.addIoPriority(IORING_ACCEPT_POLL_FIRST);
 
-    return internal::AsyncWaiter{submission};
+    internal::AsyncWaiter asyncWaiter{submission};
+    asyncWaiter.setDirectAllocation();
+
+    return asyncWaiter;
 }
 
 auto coContext::multipleAccept(std::move_only_function<auto(std::int32_t)->Task<>> action,
@@ -260,6 +368,7 @@ auto coContext::multipleAcceptDirect(std::move_only_function<auto(std::int32_t)-
     submission.addIoPriority(IORING_ACCEPT_POLL_FIRST);
 
     internal::AsyncWaiter asyncWaiter{internal::AsyncWaiter{submission} | marker};
+    asyncWaiter.setDirectAllocation();
 
     do co_await action(co_await asyncWaiter);
     while ((asyncWaiter.getResumeFlags() & IORING_CQE_F_MORE) != 0);
@@ -291,16 +400,28 @@ auto coContext::receive(const std::int32_t socketFileDescriptor, msghdr *const m
 
 auto coContext::multipleReceive(std::move_only_function<auto(std::int32_t, std::span<const std::byte>)->Task<>> action,
                                 const std::int32_t socketFileDescriptor, const std::int32_t flags,
-                                const internal::Marker marker) -> Task<> {
+                                const internal::Marker marker, const BufferGroup bufferGroup) -> Task<> {
+    return multipleReceive(
+        [action = std::move(action)](const std::int32_t result, const BufferLease lease) mutable -> Task<> {
+            co_await action(result, lease.getData());
+        },
+        socketFileDescriptor, flags, marker, bufferGroup);
+}
+
+auto coContext::multipleReceive(std::move_only_function<auto(std::int32_t, BufferLease)->Task<>> action,
+                                const std::int32_t socketFileDescriptor, const std::int32_t flags,
+                                const internal::Marker marker, const BufferGroup bufferGroup) -> Task<> {
     bool isRestart;
     do {
         isRestart = false;
 
+        internal::BufferRing &bufferRing{selectBufferRing(bufferGroup)};
+
         const internal::Submission submission{internal::Submission::multipleReceive(
             context.getSubmission(), socketFileDescriptor, std::span<std::byte>{}, flags)};
         submission.addFlags(IOSQE_BUFFER_SELECT);
         submission.addIoPriority(IORING_RECVSEND_POLL_FIRST);
-        submission.setBufferGroup(context.getBufferRing().getId());
+        submission.setBufferGroup(bufferRing.getId());
 
         internal::AsyncWaiter asyncWaiter{internal::AsyncWaiter{submission} | marker};
 
@@ -308,32 +429,117 @@ auto coContext::multipleReceive(std::move_only_function<auto(std::int32_t, std::
         do {
             const std::int32_t result{co_await asyncWaiter};
             if (result == -ENOBUFS) {
-                logger::write(Log{
-                    Log::Level::warn,
-                    std::pmr::string{std::error_code{std::abs(result), std::generic_category()}.message(),
-                                     internal::getSyncMemoryResource()}
-                });
+                isRestart = bufferRing.handleNoBuffer();
+                if (!isRestart) co_await action(result, BufferLease{});
+
+                break;
+            }
 
-                try {
-                    context.getBufferRing().expandBuffer();
-                } catch (internal::Exception &exception) { logger::write(std::move(exception.getLog())); }
+            resumeFlags = asyncWaiter.getResumeFlags();
+
+            BufferLease lease;
+            if ((resumeFlags & IORING_CQE_F_BUFFER) != 0) {
+                const auto bufferId{static_cast<std::uint16_t>(resumeFlags >> IORING_CQE_BUFFER_SHIFT)};
+                lease = BufferLease{std::addressof(bufferRing), bufferId, bufferRing.readData(bufferId, result)};
+                context.observeReceiveSize(result);
+
+                if ((resumeFlags & IORING_CQE_F_BUF_MORE) == 0) bufferRing.finishBuffer(bufferId);
+            }
 
-                isRestart = true;
+            co_await action(result, std::move(lease));
+        } while ((resumeFlags & IORING_CQE_F_MORE) != 0);
+    } while (isRestart);
+}
+
+auto coContext::multipleReceiveBundle(
+    std::move_only_function<auto(std::int32_t, std::pmr::vector<BufferLease>)->Task<>> action,
+    const std::int32_t socketFileDescriptor, const std::int32_t flags, const internal::Marker marker,
+    const BufferGroup bufferGroup) -> Task<> {
+    bool isRestart;
+    do {
+        isRestart = false;
+
+        internal::BufferRing &bufferRing{selectBufferRing(bufferGroup)};
+
+        const internal::Submission submission{internal::Submission::multipleReceive(
+            context.getSubmission(), socketFileDescriptor, std::span<std::byte>{}, flags)};
+        submission.addFlags(IOSQE_BUFFER_SELECT);
+        submission.addIoPriority(IORING_RECVSEND_POLL_FIRST | IORING_RECVSEND_BUNDLE);
+        submission.setBufferGroup(bufferRing.getId());
+
+        internal::AsyncWaiter asyncWaiter{internal::AsyncWaiter{submission} | marker};
+
+        std::uint32_t resumeFlags;
+        do {
+            const std::int32_t result{co_await asyncWaiter};
+            if (result == -ENOBUFS) {
+                isRestart = bufferRing.handleNoBuffer();
+                if (!isRestart)
+                    co_await action(result, std::pmr::vector<BufferLease>{internal::getUnsyncMemoryResource()});
+
+                break;
+            }
+
+            resumeFlags = asyncWaiter.getResumeFlags();
+
+            std::pmr::vector<BufferLease> leases{internal::getUnsyncMemoryResource()};
+            if ((resumeFlags & IORING_CQE_F_BUFFER) != 0) {
+                leases = bufferRing.readBundle(resumeFlags >> IORING_CQE_BUFFER_SHIFT, result);
+                context.observeReceiveSize(result);
+            }
+
+            co_await action(result, std::move(leases));
+        } while ((resumeFlags & IORING_CQE_F_MORE) != 0);
+    } while (isRestart);
+}
+
+auto coContext::multipleReceiveMessage(std::move_only_function<auto(std::int32_t, ReceivedMessage)->Task<>> action,
+                                       const std::int32_t socketFileDescriptor, const socklen_t addressLength,
+                                       const std::size_t controlLength, const std::uint32_t flags,
+                                       const internal::Marker marker, const BufferGroup bufferGroup) -> Task<> {
+    // only the lengths are read, the kernel lays out each datagram as io_uring_recvmsg_out, name, control and payload
+    msghdr message{};
+    message.msg_namelen = addressLength;
+    message.msg_controllen = controlLength;
+
+    bool isRestart;
+    do {
+        isRestart = false;
+
+        internal::BufferRing &bufferRing{selectBufferRing(bufferGroup)};
+
+        const internal::Submission submission{internal::Submission::multipleReceive(
+            context.getSubmission(), socketFileDescriptor, std::addressof(message), flags)};
+        submission.addFlags(IOSQE_BUFFER_SELECT);
+        submission.setBufferGroup(bufferRing.getId());
+
+        internal::AsyncWaiter asyncWaiter{internal::AsyncWaiter{submission} | marker};
+
+        std::uint32_t resumeFlags;
+        do {
+            std::int32_t result{co_await asyncWaiter};
+            if (result == -ENOBUFS) {
+                isRestart = bufferRing.handleNoBuffer();
+                if (!isRestart) co_await action(result, ReceivedMessage{});
 
                 break;
             }
 
             resumeFlags = asyncWaiter.getResumeFlags();
 
-            std::span<const std::byte> data;
+            ReceivedMessage receivedMessage{};
             if ((resumeFlags & IORING_CQE_F_BUFFER) != 0) {
-                const std::uint32_t bufferId{resumeFlags >> IORING_CQE_BUFFER_SHIFT};
-                data = context.getBufferRing().readData(bufferId, result);
+                const auto bufferId{static_cast<std::uint16_t>(resumeFlags >> IORING_CQE_BUFFER_SHIFT)};
+                const std::span data{bufferRing.readData(bufferId, result)};
+                receivedMessage.lease = BufferLease{std::addressof(bufferRing), bufferId, data};
+                context.observeReceiveSize(result);
 
-                if ((resumeFlags & IORING_CQE_F_BUF_MORE) == 0) context.getBufferRing().markBufferUsed(bufferId);
+                if ((resumeFlags & IORING_CQE_F_BUF_MORE) == 0) bufferRing.finishBuffer(bufferId);
+
+                if (result = parseMessage(data, message, receivedMessage); result < 0) receivedMessage = {};
             }
 
-            co_await action(result, data);
+            co_await action(result, std::move(receivedMessage));
         } while ((resumeFlags & IORING_CQE_F_MORE) != 0);
     } while (isRestart);
 }
@@ -366,47 +572,63 @@ auto coContext::send(const std::int32_t socketFileDescriptor, const msghdr *cons
     return internal::AsyncWaiter{submission};
 }
 
-auto coContext::zeroCopySend(std::move_only_function<auto(std::int32_t)->Task<>> action,
-                             const std::int32_t socketFileDescriptor, const std::span<const std::byte> buffer,
-                             std::int32_t flags, const internal::Marker marker) -> Task<> {
-    if ((marker.getFlags() & IOSQE_IO_LINK) != 0) flags |= MSG_WAITALL;
+auto coContext::sendFixed(const std::int32_t socketFileDescriptor, const FixedBuffer buffer, const std::int32_t flags)
+    -> internal::AsyncWaiter {
+    const internal::Submission submission{internal::Submission::sendFixed(context.getSubmission(), socketFileDescriptor,
+                                                                          buffer.data, flags, buffer.index)};
+    submission.addIoPriority(IORING_RECVSEND_POLL_FIRST);
 
-    internal::AsyncWaiter asyncWaiter{
-        internal::AsyncWaiter{internal::Submission::zeroCopySend(context.getSubmission(), socketFileDescriptor, buffer,
-                                                                 flags, IORING_RECVSEND_POLL_FIRST)} |
-        marker};
+    return internal::AsyncWaiter{submission};
+}
 
-    const std::int32_t result{co_await asyncWaiter};
-    if ((asyncWaiter.getResumeFlags() & IORING_CQE_F_MORE) != 0) co_await asyncWaiter;
-    else {
-        logger::write(Log{
-            Log::Level::warn, std::pmr::string{"no notification", internal::getSyncMemoryResource()}
-        });
-    }
+auto coContext::zeroCopySend(const std::int32_t socketFileDescriptor, const std::span<const std::byte> buffer,
+                             const std::int32_t flags, std::move_only_function<auto()->void> release)
+    -> internal::AsyncWaiter {
+    internal::AsyncWaiter asyncWaiter{
+        std::size(buffer) < context.getZeroCopyThreshold() ?
+            send(socketFileDescriptor, buffer, flags) :
+            internal::AsyncWaiter{internal::Submission::zeroCopySend(context.getSubmission(), socketFileDescriptor,
+                                                                     buffer, flags, IORING_RECVSEND_POLL_FIRST)}};
+    asyncWaiter.setNotification(std::move(release));
 
-    co_await action(result);
+    return asyncWaiter;
 }
 
-auto coContext::zeroCopySend(std::move_only_function<auto(std::int32_t)->Task<>> action,
-                             const std::int32_t socketFileDescriptor, const msghdr *const message, std::int32_t flags,
-                             const internal::Marker marker) -> Task<> {
-    if ((marker.getFlags() & IOSQE_IO_LINK) != 0) flags |= MSG_WAITALL;
+auto coContext::zeroCopySend(const std::int32_t socketFileDescriptor, const msghdr *const message,
+                             const std::int32_t flags, std::move_only_function<auto()->void> release)
+    -> internal::AsyncWaiter {
+    std::size_t size{};
+    for (std::size_t i{}; i != message->msg_iovlen; ++i) size += message->msg_iov[i].iov_len;
+
+    if (size < context.getZeroCopyThreshold()) {
+        internal::AsyncWaiter asyncWaiter{send(socketFileDescriptor, message, flags)};
+        asyncWaiter.setNotification(std::move(release));
+
+        return asyncWaiter;
+    }
 
     const internal::Submission submission{
         internal::Submission::zeroCopySend(context.getSubmission(), socketFileDescriptor, message, flags)};
     submission.addIoPriority(IORING_RECVSEND_POLL_FIRST);
 
-    internal::AsyncWaiter asyncWaiter{internal::AsyncWaiter{submission} | marker};
+    internal::AsyncWaiter asyncWaiter{submission};
+    asyncWaiter.setNotification(std::move(release));
 
-    const std::int32_t result{co_await asyncWaiter};
-    if ((asyncWaiter.getResumeFlags() & IORING_CQE_F_MORE) != 0) co_await asyncWaiter;
-    else {
-        logger::write(Log{
-            Log::Level::warn, std::pmr::string{"no notification", internal::getSyncMemoryResource()}
-        });
-    }
+    return asyncWaiter;
+}
 
-    co_await action(result);
+auto coContext::zeroCopySendFixed(const std::int32_t socketFileDescriptor, const FixedBuffer buffer,
+                                  const std::int32_t flags, std::move_only_function<auto()->void> release)
+    -> internal::AsyncWaiter {
+    internal::AsyncWaiter asyncWaiter{
+        std::size(buffer.data) < context.getZeroCopyThreshold() ?
+            sendFixed(socketFileDescriptor, buffer, flags) :
+            internal::AsyncWaiter{internal::Submission::zeroCopySendFixed(context.getSubmission(), socketFileDescriptor,
+                                                                          buffer.data, flags,
+                                                                          IORING_RECVSEND_POLL_FIRST, buffer.index)}};
+    asyncWaiter.setNotification(std::move(release));
+
+    return asyncWaiter;
 }
 
 auto coContext::splice(const std::int32_t inFileDescriptor, const std::int64_t inOffset,
@@ -441,20 +663,29 @@ auto coContext::open(const std::int32_t directoryFileDescriptor, const std::file
 
 auto coContext::openDirect(const std::filesystem::path &path, const std::int32_t flags, const mode_t mode)
     -> internal::AsyncWaiter {
-    return internal::AsyncWaiter{
+    internal::AsyncWaiter asyncWaiter{
         internal::Submission::openDirect(context.getSubmission(), path, flags, mode, IORING_FILE_INDEX_ALLOC)};
+    asyncWaiter.setDirectAllocation();
+
+    return asyncWaiter;
 }
 
 auto coContext::openDirect(const std::int32_t directoryFileDescriptor, const std::filesystem::path &path,
                            const std::int32_t flags, const mode_t mode) -> internal::AsyncWaiter {
-    return internal::AsyncWaiter{internal::Submission::openDirect(context.getSubmission(), directoryFileDescriptor,
-                                                                  path, flags, mode, IORING_FILE_INDEX_ALLOC)};
+    internal::AsyncWaiter asyncWaiter{internal::Submission::openDirect(
+        context.getSubmission(), directoryFileDescriptor, path, flags, mode, IORING_FILE_INDEX_ALLOC)};
+    asyncWaiter.setDirectAllocation();
+
+    return asyncWaiter;
 }
 
 auto coContext::openDirect(const std::int32_t directoryFileDescriptor, const std::filesystem::path &path,
                            open_how *const openHow) -> internal::AsyncWaiter {
-    return internal::AsyncWaiter{internal::Submission::openDirect(context.getSubmission(), directoryFileDescriptor,
-                                                                  path, openHow, IORING_FILE_INDEX_ALLOC)};
+    internal::AsyncWaiter asyncWaiter{internal::Submission::openDirect(
+        context.getSubmission(), directoryFileDescriptor, path, openHow, IORING_FILE_INDEX_ALLOC)};
+    asyncWaiter.setDirectAllocation();
+
+    return asyncWaiter;
 }
 
 auto coContext::read(const std::int32_t fileDescriptor, const std::span<std::byte> buffer, const std::uint64_t offset)
@@ -473,48 +704,58 @@ auto coContext::read(const std::int32_t fileDescriptor, const std::span<const io
         internal::Submission::read(context.getSubmission(), fileDescriptor, buffer, offset, flags)};
 }
 
+auto coContext::readFixed(const std::int32_t fileDescriptor, const FixedBuffer buffer, const std::uint64_t offset)
+    -> internal::AsyncWaiter {
+    return internal::AsyncWaiter{internal::Submission::readFixed(context.getSubmission(), fileDescriptor, buffer.data,
+                                                                 offset, static_cast<std::int32_t>(buffer.index))};
+}
+
 auto coContext::multipleRead(std::move_only_function<auto(std::int32_t, std::span<const std::byte>)->Task<>> action,
                              const std::int32_t fileDescriptor, const std::int32_t offset,
-                             const internal::Marker marker) -> Task<> {
+                             const internal::Marker marker, const BufferGroup bufferGroup) -> Task<> {
+    return multipleRead(
+        [action = std::move(action)](const std::int32_t result, const BufferLease lease) mutable -> Task<> {
+            co_await action(result, lease.getData());
+        },
+        fileDescriptor, offset, marker, bufferGroup);
+}
+
+auto coContext::multipleRead(std::move_only_function<auto(std::int32_t, BufferLease)->Task<>> action,
+                             const std::int32_t fileDescriptor, const std::int32_t offset,
+                             const internal::Marker marker, const BufferGroup bufferGroup) -> Task<> {
     bool isRestart;
     do {
         isRestart = false;
 
+        internal::BufferRing &bufferRing{selectBufferRing(bufferGroup)};
+
         internal::AsyncWaiter asyncWaiter{
             internal::AsyncWaiter{internal::Submission::multipleRead(context.getSubmission(), fileDescriptor, 0, offset,
-                                                                     context.getBufferRing().getId())} |
+                                                                     bufferRing.getId())} |
             marker};
 
         std::uint32_t resumeFlags;
         do {
             const std::int32_t result{co_await asyncWaiter};
             if (result == -ENOBUFS) {
-                logger::write(Log{
-                    Log::Level::warn,
-                    std::pmr::string{std::error_code{std::abs(result), std::generic_category()}.message(),
-                                     internal::getSyncMemoryResource()}
-                });
-
-                try {
-                    context.getBufferRing().expandBuffer();
-                } catch (internal::Exception &exception) { logger::write(std::move(exception.getLog())); }
-
-                isRestart = true;
+                isRestart = bufferRing.handleNoBuffer();
+                if (!isRestart) co_await action(result, BufferLease{});
 
                 break;
             }
 
             resumeFlags = asyncWaiter.getResumeFlags();
 
-            std::span<const std::byte> data;
+            BufferLease lease;
             if ((resumeFlags & IORING_CQE_F_BUFFER) != 0) {
-                const std::uint32_t bufferId{resumeFlags >> IORING_CQE_BUFFER_SHIFT};
-                data = context.getBufferRing().readData(bufferId, result);
+                const auto bufferId{static_cast<std::uint16_t>(resumeFlags >> IORING_CQE_BUFFER_SHIFT)};
+                lease = BufferLease{std::addressof(bufferRing), bufferId, bufferRing.readData(bufferId, result)};
+                context.observeReceiveSize(result);
 
-                if ((resumeFlags & IORING_CQE_F_BUF_MORE) == 0) context.getBufferRing().markBufferUsed(bufferId);
+                if ((resumeFlags & IORING_CQE_F_BUF_MORE) == 0) bufferRing.finishBuffer(bufferId);
             }
 
-            co_await action(result, data);
+            co_await action(result, std::move(lease));
         } while ((resumeFlags & IORING_CQE_F_MORE) != 0);
     } while (isRestart);
 }
@@ -535,6 +776,12 @@ auto coContext::write(const std::int32_t fileDescriptor, const std::span<const i
         internal::Submission::write(context.getSubmission(), fileDescriptor, buffer, offset, flags)};
 }
 
+auto coContext::writeFixed(const std::int32_t fileDescriptor, const FixedBuffer buffer, const std::uint64_t offset)
+    -> internal::AsyncWaiter {
+    return internal::AsyncWaiter{internal::Submission::writeFixed(context.getSubmission(), fileDescriptor, buffer.data,
+                                                                  offset, static_cast<std::int32_t>(buffer.index))};
+}
+
 auto coContext::syncFile(const std::int32_t fileDescriptor, const bool isSyncMetadata) -> internal::AsyncWaiter {
     return internal::AsyncWaiter{internal::Submission::syncFile(context.getSubmission(), fileDescriptor,
                                                                 isSyncMetadata ? 0 : IORING_FSYNC_DATASYNC)};
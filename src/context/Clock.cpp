@@ -0,0 +1,33 @@
+#include "coContext/context/Clock.hpp"
+
+#include <ctime>
+#include <memory>
+
+namespace {
+    thread_local std::chrono::steady_clock::time_point cachedNow;
+    thread_local std::chrono::system_clock::time_point cachedWallNow;
+    thread_local bool isCached;
+}    // namespace
+
+auto coContext::internal::refreshClock() noexcept -> void {
+    cachedNow = std::chrono::steady_clock::now();
+
+    // the coarse clock is copied from the vDSO data page without reading the time counter
+    timespec wallTime{};
+    clock_gettime(CLOCK_REALTIME_COARSE, std::addressof(wallTime));
+    cachedWallNow = std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds{wallTime.tv_sec} +
+                                                                        std::chrono::nanoseconds{wallTime.tv_nsec})};
+
+    isCached = true;
+}
+
+auto coContext::internal::invalidateClock() noexcept -> void { isCached = false; }
+
+auto coContext::now() noexcept -> std::chrono::steady_clock::time_point {
+    return isCached ? cachedNow : std::chrono::steady_clock::now();
+}
+
+auto coContext::wallNow() noexcept -> std::chrono::system_clock::time_point {
+    return isCached ? cachedWallNow : std::chrono::system_clock::now();
+}
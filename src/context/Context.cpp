@@ -1,47 +1,149 @@
 #include "Context.hpp"
 
 #include "../log/Exception.hpp"
-#include "../ring/Completion.hpp"
+#include "../memory/FrameAllocator.hpp"
+#include "coContext/coroutine/AsyncWaiter.hpp"
 #include "coContext/coroutine/BasePromise.hpp"
 #include "coContext/log/logger.hpp"
+#include "coContext/ring/Submission.hpp"
 
 #include <sys/resource.h>
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <format>
+#include <limits>
+#include <utility>
+
 using namespace std::string_view_literals;
 
-coContext::internal::Context::Context() {
-    try {
-        this->ring->registerSelfFileDescriptor();
-    } catch (Exception &exception) { logger::write(Log{std::move(exception.getLog())}); }
+namespace {
+    [[nodiscard]] auto toTimeSpecification(const std::chrono::steady_clock::time_point time) noexcept
+        -> __kernel_timespec {
+        const std::chrono::nanoseconds sinceEpoch{time.time_since_epoch()};
 
-    this->ring->registerSparseFileDescriptor(
-        [](const std::source_location sourceLocation = std::source_location::current()) constexpr {
-            rlimit limit{};
-            if (getrlimit(RLIMIT_NOFILE, std::addressof(limit)) == -1) {
-                throw Exception{
-                    Log{Log::Level::fatal,
-                        std::pmr::string{std::error_code{errno, std::generic_category()}.message(),
-                                         getSyncMemoryResource()},
-                        sourceLocation}
-                };
-            }
+        return __kernel_timespec{std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch).count(),
+                                 (sinceEpoch % std::chrono::seconds{1}).count()};
+    }
+}    // namespace
 
-            return limit.rlim_cur;
-        }());
+coContext::internal::Context::Context(const ContextOptions &options) :
+    ring{makeRing(options)}, zeroCopyThreshold{options.zeroCopyThreshold},
+    fixedBufferPool{ring, options.fixedBufferCount, options.fixedBufferSize},
+    timerWheel{options.timerTick}, directFileDescriptorCount{options.directFileDescriptorCount} {
+    // constructed first so that it outlives the frames this context destroys
+    configureFrameAllocator(options);
+
+    this->setupBufferRings(options);
+    this->registerRing();
 }
 
 auto coContext::internal::Context::swap(Context &other) noexcept -> void {
     std::swap(this->ring, other.ring);
-    std::swap(this->bufferRing, other.bufferRing);
+    std::swap(this->bufferRings, other.bufferRings);
+    std::swap(this->receiveSize, other.receiveSize);
+    std::swap(this->zeroCopyThreshold, other.zeroCopyThreshold);
+    std::swap(this->fixedBufferPool, other.fixedBufferPool);
+    std::swap(this->timerWheel, other.timerWheel);
     std::swap(this->unscheduledCoroutines, other.unscheduledCoroutines);
-    std::swap(this->schedulingCoroutines, other.schedulingCoroutines);
+    std::swap(this->wokenCoroutines, other.wokenCoroutines);
+    std::swap(this->suspensionTable, other.suspensionTable);
+    std::swap(this->notifications, other.notifications);
+    std::swap(this->timerWheelDeadline, other.timerWheelDeadline);
+    std::swap(this->timerWheelTimeSpecification, other.timerWheelTimeSpecification);
+    std::swap(this->expiredTimerCount, other.expiredTimerCount);
+    std::swap(this->timerStatistics, other.timerStatistics);
+    std::swap(this->cancellationScope, other.cancellationScope);
+    std::swap(this->scheduler, other.scheduler);
+    std::swap(this->schedulerIndex, other.schedulerIndex);
+    std::swap(this->directFileDescriptorCount, other.directFileDescriptorCount);
+    std::swap(this->isDirectFileDescriptorRegistered, other.isDirectFileDescriptorRegistered);
     std::swap(this->isRunning, other.isRunning);
 }
 
-auto coContext::internal::Context::getBufferRing() noexcept -> BufferRing & { return this->bufferRing; }
+auto coContext::internal::Context::getBufferRing(const std::size_t index) noexcept -> BufferRing & {
+    return this->bufferRings[index];
+}
+
+auto coContext::internal::Context::selectBufferRing() noexcept -> BufferRing & {
+    const auto bufferRing{std::ranges::find_if(this->bufferRings, [this](const BufferRing &bufferRing) constexpr {
+        return bufferRing.getBufferSize() >= this->receiveSize;
+    })};
+
+    return bufferRing != std::end(this->bufferRings) ? *bufferRing : this->bufferRings.back();
+}
+
+auto coContext::internal::Context::getFixedBufferPool() noexcept -> FixedBufferPool & {
+    return this->fixedBufferPool;
+}
+
+auto coContext::internal::Context::observeReceiveSize(const std::size_t size) noexcept -> void {
+    this->receiveSize = (this->receiveSize * 7 + size) / 8;
+}
+
+auto coContext::internal::Context::getZeroCopyThreshold() const noexcept -> std::size_t {
+    return this->zeroCopyThreshold;
+}
+
+auto coContext::internal::Context::getDirectFileDescriptorCount() const noexcept -> std::uint32_t {
+    return this->directFileDescriptorCount;
+}
+
+auto coContext::internal::Context::configure(const ContextOptions &options, const std::source_location sourceLocation)
+    -> void {
+    if (this->isRunning) {
+        throw Exception{
+            Log{Log::Level::error, std::pmr::string{"context is already running"sv, getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    // armed timers are linked by tick, which another tick would reinterpret
+    if (!this->timerWheel.isEmpty() && options.timerTick != this->timerWheel.getTick()) {
+        throw Exception{
+            Log{Log::Level::error,
+                std::pmr::string{"timer tick cannot change while timers are armed"sv, getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    this->ring = makeRing(options);
+    this->setupBufferRings(options);
+    this->fixedBufferPool = FixedBufferPool{this->ring, options.fixedBufferCount, options.fixedBufferSize};
+    this->zeroCopyThreshold = options.zeroCopyThreshold;
+    configureFrameAllocator(options);
+    if (this->timerWheel.isEmpty()) this->timerWheel = TimerWheel{options.timerTick};
+    this->directFileDescriptorCount = options.directFileDescriptorCount;
+    this->isDirectFileDescriptorRegistered = false;
+    this->registerRing();
+
+    // the armed timeout went with the old ring
+    this->timerWheelDeadline = std::chrono::steady_clock::time_point::min();
+    if (const std::optional deadline{this->timerWheel.getNextExpiry()}; deadline) this->armTimerWheel(*deadline);
+
+    if (this->scheduler != nullptr)
+        this->scheduler->setRingFileDescriptor(this->schedulerIndex, this->ring->getFileDescriptor());
+}
+
+auto coContext::internal::Context::getRingFileDescriptor() const noexcept -> std::int32_t {
+    return this->ring->getFileDescriptor();
+}
+
+auto coContext::internal::Context::attach(Scheduler *const scheduler, const std::uint32_t index) noexcept -> void {
+    if (this->scheduler != nullptr) this->scheduler->setRingFileDescriptor(this->schedulerIndex, -1);
+
+    this->scheduler = scheduler;
+    this->schedulerIndex = index;
+
+    if (this->scheduler != nullptr) this->scheduler->setRingFileDescriptor(index, this->ring->getFileDescriptor());
+}
 
 auto coContext::internal::Context::run(const std::source_location sourceLocation) -> void {
+    this->registerDirectFileDescriptor();
+
     this->isRunning = true;
+    refreshClock();
 
     logger::write(Log{
         Log::Level::info, std::pmr::string{"context running"sv, getSyncMemoryResource()},
@@ -49,23 +151,27 @@ auto coContext::internal::Context::run(const std::source_location sourceLocation
     });
 
     this->scheduleUnscheduledCoroutines();
-
-    while (this->isRunning) {
-        this->ring->submitAndWait(1);
-        this->bufferRing.advance(this->ring->poll([this](const Completion completion) constexpr {
-            const auto result{this->schedulingCoroutines.find(completion.getUserData())};
-            Coroutine coroutine{std::move(result->second)};
-            this->schedulingCoroutines.erase(result);
-
-            coroutine.getPromise().setResult(completion.getResult());
-            coroutine.getPromise().setFlags(completion.getFlags());
-
-            this->scheduleCoroutine(std::move(coroutine));
-        }));
+    this->scheduleQueuedCoroutines();
+
+    while (!this->isStopped()) {
+        // an attached context only blocks once no queue holds work, pushes and stop() wake it through a message
+        const bool isIdle{std::empty(this->wokenCoroutines) && std::empty(this->unscheduledCoroutines) &&
+                          (this->scheduler == nullptr || this->scheduler->park(this->schedulerIndex))};
+        this->ring->submitAndWait(isIdle ? 1 : 0);
+        if (isIdle && this->scheduler != nullptr) this->scheduler->unpark(this->schedulerIndex);
+        refreshClock();
+        this->processCompletions();
+        this->resumeWokenCoroutines();
+        this->recordTimerWakeup();
 
         this->scheduleUnscheduledCoroutines();
+        this->scheduleQueuedCoroutines();
+        this->maintainBufferRings();
     }
 
+    this->isRunning = false;
+    invalidateClock();
+
     logger::write(Log{
         Log::Level::info, std::pmr::string{"context stopped"sv, getSyncMemoryResource()},
          sourceLocation
@@ -74,6 +180,7 @@ auto coContext::internal::Context::run(const std::source_location sourceLocation
 
 auto coContext::internal::Context::stop(const std::source_location sourceLocation) -> void {
     this->isRunning = false;
+    if (this->scheduler != nullptr) this->scheduler->stop();
 
     logger::write(Log{
         Log::Level::info, std::pmr::string{"context stopping"sv, getSyncMemoryResource()},
@@ -81,8 +188,134 @@ auto coContext::internal::Context::stop(const std::source_location sourceLocatio
     });
 }
 
-auto coContext::internal::Context::spawn(Coroutine coroutine) -> void {
+auto coContext::internal::Context::spawn(Coroutine coroutine) -> std::uint64_t {
+    const std::uint64_t id{this->suspensionTable.reserve(nullptr)};
+    coroutine.getPromise().setId(id);
+
     this->unscheduledCoroutines.emplace_back(std::move(coroutine));
+
+    return id;
+}
+
+auto coContext::internal::Context::spawnBalanced(Coroutine coroutine) -> std::uint64_t {
+    if (this->scheduler == nullptr) return this->spawn(std::move(coroutine));
+
+    static_cast<void>(this->scheduler->push(std::move(coroutine)));
+
+    return BasePromise::invalidId;
+}
+
+auto coContext::internal::Context::reserve(const Coroutine::Handle handle) -> std::uint64_t {
+    return this->suspensionTable.reserve(handle);
+}
+
+auto coContext::internal::Context::release(const std::uint64_t id) noexcept -> void {
+    this->suspensionTable.release(id);
+}
+
+auto coContext::internal::Context::isPending(const std::uint64_t id) const noexcept -> bool {
+    return this->suspensionTable.find(id) != nullptr;
+}
+
+auto coContext::internal::Context::reserveNotification(std::move_only_function<auto()->void> release)
+    -> std::uint64_t {
+    const std::uint64_t id{this->suspensionTable.reserve(nullptr)};
+
+    const auto index{static_cast<std::uint32_t>(id)};
+    if (std::size(this->notifications) <= index) this->notifications.resize(index + 1);
+    this->notifications[index] = std::move(release);
+
+    return id;
+}
+
+auto coContext::internal::Context::bind(const std::uint64_t id, const Coroutine::Handle handle) noexcept -> void {
+    this->suspensionTable.bind(id, handle);
+}
+
+auto coContext::internal::Context::notify(const std::uint64_t id) -> void {
+    this->suspensionTable.release(id);
+
+    std::move_only_function<auto()->void> release{
+        std::exchange(this->notifications[static_cast<std::uint32_t>(id)], nullptr)};
+    if (release) release();
+}
+
+auto coContext::internal::Context::wake(const Coroutine::Handle handle, const std::int32_t result) -> void {
+    handle.promise().setResult(result);
+    handle.promise().setFlags(0);
+
+    this->wokenCoroutines.emplace_back(handle);
+}
+
+auto coContext::internal::Context::getCancellationScope() const noexcept -> CancellationScope * {
+    return this->cancellationScope;
+}
+
+auto coContext::internal::Context::setCancellationScope(CancellationScope *const cancellationScope) noexcept -> void {
+    this->cancellationScope = cancellationScope;
+}
+
+auto coContext::internal::Context::addTimer(Timer &timer, const std::chrono::nanoseconds duration) -> void {
+    const std::chrono::steady_clock::time_point expiry{this->timerWheel.add(timer, duration)};
+    if (this->timerWheelDeadline == std::chrono::steady_clock::time_point::min()) {
+        this->armTimerWheel(expiry);
+
+        return;
+    }
+
+    if (expiry >= this->timerWheelDeadline) return;
+
+    // pulls the armed timeout in, the kernel copies the time when the update is submitted
+    this->timerWheelDeadline = expiry;
+    this->timerWheelTimeSpecification = toTimeSpecification(expiry);
+
+    const Submission submission{Submission::updateTimeout(this->getSubmission(), timerWheelId,
+                                                          std::addressof(this->timerWheelTimeSpecification),
+                                                          IORING_TIMEOUT_ABS)};
+    submission.setUserData(BasePromise::invalidId);
+}
+
+auto coContext::internal::Context::removeTimer(Timer &timer) noexcept -> void { this->timerWheel.remove(timer); }
+
+auto coContext::internal::Context::getTimerStatistics() const noexcept -> TimerStatistics {
+    return this->timerStatistics;
+}
+
+auto coContext::internal::Context::getId(const std::source_location sourceLocation) const -> std::uint32_t {
+    if (this->scheduler == nullptr) {
+        throw Exception{
+            Log{Log::Level::error, std::pmr::string{"context is not attached to a runtime"sv, getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    return this->schedulerIndex;
+}
+
+auto coContext::internal::Context::spawnOn(const std::uint32_t id, Coroutine coroutine,
+                                           const std::source_location sourceLocation) -> void {
+    if (id == this->getId(sourceLocation)) {
+        this->spawn(std::move(coroutine));
+
+        return;
+    }
+
+    const std::int32_t ringFileDescriptor{
+        id < this->scheduler->getCount() ? this->scheduler->getRingFileDescriptor(id) : -1};
+    if (ringFileDescriptor == -1) {
+        throw Exception{
+            Log{Log::Level::error, std::pmr::string{"target context is not running"sv, getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    // the frame stays reachable through a slot of its own until the message completes, so that a message the target
+    // never receives gives the coroutine back to this context instead of leaking it
+    const Coroutine::Handle handle{coroutine.release()};
+    const Submission submission{Submission::messageRing(
+        this->getSubmission(), ringFileDescriptor, 0,
+        static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(handle.address())), spawnFlag)};
+    submission.setUserData(this->suspensionTable.reserve(handle) | messageBit);
 }
 
 auto coContext::internal::Context::getSubmission() const -> io_uring_sqe * {
@@ -122,6 +355,200 @@ auto coContext::internal::Context::syncCancel(const std::variant<std::uint64_t,
     }
 }
 
+auto coContext::internal::Context::makeRing(const ContextOptions &options) -> std::shared_ptr<Ring> {
+    io_uring_params parameters{};
+    parameters.flags = IORING_SETUP_SUBMIT_ALL | IORING_SETUP_SINGLE_ISSUER;
+
+    if (options.isSubmissionPoll) {
+        parameters.flags |= IORING_SETUP_SQPOLL;
+        parameters.sq_thread_idle = static_cast<std::uint32_t>(options.submissionPollIdle.count());
+
+        if (options.submissionPollCpu != -1) {
+            parameters.flags |= IORING_SETUP_SQ_AFF;
+            parameters.sq_thread_cpu = static_cast<std::uint32_t>(options.submissionPollCpu);
+        }
+    } else parameters.flags |= IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG | IORING_SETUP_DEFER_TASKRUN;
+
+    if (options.completionEntries != 0) {
+        parameters.flags |= IORING_SETUP_CQSIZE;
+        parameters.cq_entries = options.completionEntries;
+    }
+
+    if (options.isNoSubmissionArray) parameters.flags |= IORING_SETUP_NO_SQARRAY;
+
+    if (options.workQueueRingFileDescriptor != -1) {
+        parameters.flags |= IORING_SETUP_ATTACH_WQ;
+        parameters.wq_fd = static_cast<std::uint32_t>(options.workQueueRingFileDescriptor);
+    }
+
+    return std::allocate_shared<Ring>(std::pmr::polymorphic_allocator{getUnsyncMemoryResource()},
+                                      options.submissionEntries, std::addressof(parameters));
+}
+
+auto coContext::internal::Context::configureFrameAllocator(const ContextOptions &options) noexcept -> void {
+    if (FrameAllocator &frameAllocator{getFrameAllocator()}; options.isHugePageFrame) frameAllocator.enableHugePage();
+    else frameAllocator.disableHugePage();
+}
+
+auto coContext::internal::Context::registerRing() -> void {
+    try {
+        this->ring->registerSelfFileDescriptor();
+    } catch (Exception &exception) { logger::write(Log{std::move(exception.getLog())}); }
+}
+
+auto coContext::internal::Context::setupBufferRings(const ContextOptions &options) -> void {
+    this->bufferRings.clear();
+    for (std::size_t i{}; i != std::size(bufferSizes); ++i) {
+        this->bufferRings.emplace_back(this->ring, bufferEntries[i], static_cast<std::int32_t>(i), IOU_PBUF_RING_INC,
+                                       bufferSizes[i], options.bufferPolicy, options.isHugePageBuffer);
+    }
+}
+
+auto coContext::internal::Context::maintainBufferRings() noexcept -> void {
+    const std::chrono::steady_clock::time_point now{coContext::now()};
+    for (BufferRing &bufferRing : this->bufferRings) {
+        bufferRing.shrink(now);
+        bufferRing.advance();
+    }
+}
+
+auto coContext::internal::Context::registerDirectFileDescriptor() -> void {
+    if (this->isDirectFileDescriptorRegistered) return;
+
+    // the requested count is replaced by the registered one, which is what exhaustion errors report
+    this->directFileDescriptorCount = std::min(
+        this->directFileDescriptorCount,
+        [](const std::source_location sourceLocation = std::source_location::current()) constexpr {
+            rlimit limit{};
+            if (getrlimit(RLIMIT_NOFILE, std::addressof(limit)) == -1) {
+                throw Exception{
+                    Log{Log::Level::fatal,
+                        std::pmr::string{std::error_code{errno, std::generic_category()}.message(),
+                                         getSyncMemoryResource()},
+                        sourceLocation}
+                };
+            }
+
+            return static_cast<std::uint32_t>(
+                std::min<rlim_t>(limit.rlim_cur, std::numeric_limits<std::uint32_t>::max()));
+        }());
+    this->ring->registerSparseFileDescriptor(this->directFileDescriptorCount);
+    this->isDirectFileDescriptorRegistered = true;
+}
+
+auto coContext::internal::Context::processCompletions() -> void {
+    std::array<io_uring_cqe *, completionBatch> completions;
+    for (std::uint32_t count{this->ring->peek(completions)}; count != 0; count = this->ring->peek(completions)) {
+        const std::span batch{std::data(completions), count};
+
+        for (const io_uring_cqe *const completion : batch)
+            this->suspensionTable.prefetch(io_uring_cqe_get_data64(completion));
+        for (const io_uring_cqe *const completion : batch) {
+            if (const Coroutine::Handle handle{this->suspensionTable.find(io_uring_cqe_get_data64(completion))}; handle)
+                __builtin_prefetch(handle.address(), 1);
+        }
+        for (const io_uring_cqe *const completion : batch) this->processCompletion(Completion{completion});
+
+        this->ring->advance(count);
+    }
+}
+
+auto coContext::internal::Context::processCompletion(const Completion completion) -> void {
+    if ((completion.getFlags() & spawnFlag) != 0) [[unlikely]] {
+        this->spawn(Coroutine{Coroutine::Handle::from_address(
+            reinterpret_cast<void *>(static_cast<std::uintptr_t>(completion.getUserData())))});
+
+        return;
+    }
+
+    if (completion.getUserData() != BasePromise::invalidId && (completion.getUserData() & messageBit) != 0)
+        [[unlikely]] {
+        this->processMessageCompletion(completion);
+
+        return;
+    }
+
+    if ((completion.getFlags() & IORING_CQE_F_NOTIF) != 0) {
+        this->notify(completion.getUserData());
+
+        return;
+    }
+
+    // the wheel's own timeout counts the wheel timers it expires instead
+    if (completion.getUserData() == timerWheelId) {
+        this->processTimerWheelCompletion();
+
+        return;
+    }
+
+    if (completion.getResult() == -ETIME) ++this->expiredTimerCount;
+
+    // link timeouts are submitted without an owner, whether they fired is reported by the linked completion
+    if (completion.getUserData() == BasePromise::invalidId) return;
+
+    const Coroutine::Handle handle{this->suspensionTable.find(completion.getUserData())};
+    if (!handle) [[unlikely]] {
+        logger::write(Log{
+            Log::Level::warn, std::pmr::string{"stale completion"sv, getSyncMemoryResource()}
+        });
+
+        return;
+    }
+
+    handle.promise().setResult(completion.getResult());
+    handle.promise().setFlags(completion.getFlags());
+
+    this->resumeCoroutine(handle);
+}
+
+auto coContext::internal::Context::processMessageCompletion(const Completion completion) -> void {
+    const std::uint64_t id{completion.getUserData() & ~messageBit};
+    const Coroutine::Handle handle{this->suspensionTable.find(id)};
+    this->suspensionTable.release(id);
+
+    if (completion.getResult() >= 0 || !handle) return;
+
+    logger::write(Log{
+        Log::Level::warn,
+        std::pmr::string{std::format("spawnOn message failed, running locally: {}"sv,
+                                     std::error_code{-completion.getResult(), std::generic_category()}.message()),
+                         getSyncMemoryResource()}
+    });
+
+    this->spawn(Coroutine{handle});
+}
+
+auto coContext::internal::Context::resumeWokenCoroutines() -> void {
+    for (std::size_t i{}; i != std::size(this->wokenCoroutines); ++i) this->resumeCoroutine(this->wokenCoroutines[i]);
+
+    this->wokenCoroutines.clear();
+}
+
+auto coContext::internal::Context::recordTimerWakeup() noexcept -> void {
+    if (this->expiredTimerCount == 0) return;
+
+    ++this->timerStatistics.wakeupCount;
+    this->timerStatistics.timerCount += std::exchange(this->expiredTimerCount, 0);
+}
+
+// one absolute timeout at a time, armed for the next tick the wheel has work at and pulled in by addTimer, so an idle
+// wheel costs no wakeups and an empty one none at all
+auto coContext::internal::Context::armTimerWheel(const std::chrono::steady_clock::time_point deadline) -> void {
+    this->timerWheelDeadline = deadline;
+    this->timerWheelTimeSpecification = toTimeSpecification(deadline);
+
+    const Submission submission{Submission::timeout(
+        this->getSubmission(), std::addressof(this->timerWheelTimeSpecification), 0, IORING_TIMEOUT_ABS)};
+    submission.setUserData(timerWheelId);
+}
+
+auto coContext::internal::Context::processTimerWheelCompletion() -> void {
+    this->timerWheelDeadline = std::chrono::steady_clock::time_point::min();
+    this->expiredTimerCount += this->timerWheel.advance();
+
+    if (const std::optional deadline{this->timerWheel.getNextExpiry()}; deadline) this->armTimerWheel(*deadline);
+}
+
 auto coContext::internal::Context::scheduleUnscheduledCoroutines() -> void {
     for (std::size_t i{}; i != std::size(this->unscheduledCoroutines); ++i)
         this->scheduleCoroutine(std::move(this->unscheduledCoroutines[i]));
@@ -129,26 +556,44 @@ auto coContext::internal::Context::scheduleUnscheduledCoroutines() -> void {
     this->unscheduledCoroutines.clear();
 }
 
+auto coContext::internal::Context::scheduleQueuedCoroutines() -> void {
+    if (this->scheduler == nullptr) return;
+
+    for (std::uint32_t i{}; i != stealBatch; ++i) {
+        Coroutine coroutine{this->scheduler->pop(this->schedulerIndex)};
+        if (!coroutine) break;
+
+        this->scheduleCoroutine(std::move(coroutine));
+    }
+
+    this->scheduler->setLoad(this->schedulerIndex, this->suspensionTable.getSize());
+}
+
 auto coContext::internal::Context::scheduleCoroutine(Coroutine coroutine) -> void {
-    do {
-        coroutine();
+    BasePromise &promise{coroutine.getPromise()};
+    if (promise.getId() == BasePromise::invalidId) promise.setId(this->suspensionTable.reserve(coroutine.get()));
+    else this->suspensionTable.bind(promise.getId(), coroutine.get());
 
-        if (!coroutine.isDone()) {
-            Coroutine childCoroutine{std::move(coroutine.getPromise().getChildCoroutine())};
+    this->resumeCoroutine(coroutine.release());
+}
 
-            const std::uint64_t id{std::hash<Coroutine>{}(coroutine)};
-            this->schedulingCoroutines.emplace(id, std::move(coroutine));
+auto coContext::internal::Context::resumeCoroutine(const Coroutine::Handle handle) -> void {
+    Coroutine::Handle rootCoroutineHandle{handle};
+    while (rootCoroutineHandle.promise().getParentCoroutineHandle())
+        rootCoroutineHandle = rootCoroutineHandle.promise().getParentCoroutineHandle();
 
-            coroutine = std::move(childCoroutine);
-        } else if (const auto result{this->schedulingCoroutines.find(coroutine.getPromise().getParentCoroutineId())};
-                   result != std::cend(this->schedulingCoroutines)) {
-            Coroutine parentCoroutine{std::move(result->second)};
-            this->schedulingCoroutines.erase(result);
+    CancellationScope *const cancellationScope{
+        std::exchange(this->cancellationScope, handle.promise().getCancellationScope())};
+    handle.resume();
+    this->cancellationScope = cancellationScope;
 
-            coroutine = std::move(parentCoroutine);
-        } else if (const std::exception_ptr exception{*coroutine.getPromise().getException()}; exception) [[unlikely]] {
-            std::rethrow_exception(exception);
-        } else coroutine = Coroutine{nullptr};
+    if (!rootCoroutineHandle.done()) return;
+
+    const Coroutine rootCoroutine{rootCoroutineHandle};
+    if (const std::exception_ptr exception{rootCoroutine.getPromise().getException()}; exception) [[unlikely]]
+        std::rethrow_exception(exception);
+}
 
-    } while (coroutine);
+auto coContext::internal::Context::isStopped() const noexcept -> bool {
+    return !this->isRunning || (this->scheduler != nullptr && !this->scheduler->isRunning());
 }
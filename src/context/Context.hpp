@@ -1,13 +1,27 @@
 #pragma once
 
 #include "../ring/BufferRing.hpp"
+#include "../ring/Completion.hpp"
+#include "../ring/FixedBufferPool.hpp"
 #include "../ring/Ring.hpp"
+#include "Scheduler.hpp"
+#include "SuspensionTable.hpp"
+#include "TimerWheel.hpp"
+#include "coContext/context/ContextOptions.hpp"
 #include "coContext/coroutine/Coroutine.hpp"
+#include "coContext/coroutine/Task.hpp"
+
+#include <array>
+#include <functional>
+
+namespace coContext {
+    class CancellationScope;
+}    // namespace coContext
 
 namespace coContext::internal {
     class Context {
     public:
-        Context();
+        explicit Context(const ContextOptions &options = ContextOptions{});
 
         Context(const Context &) = delete;
 
@@ -21,13 +35,67 @@ namespace coContext::internal {
 
         auto swap(Context &other) noexcept -> void;
 
-        [[nodiscard]] auto getBufferRing() noexcept -> BufferRing &;
+        [[nodiscard]] auto getBufferRing(std::size_t index) noexcept -> BufferRing &;
+
+        [[nodiscard]] auto selectBufferRing() noexcept -> BufferRing &;
+
+        [[nodiscard]] auto getFixedBufferPool() noexcept -> FixedBufferPool &;
+
+        auto observeReceiveSize(std::size_t size) noexcept -> void;
+
+        [[nodiscard]] auto getZeroCopyThreshold() const noexcept -> std::size_t;
+
+        [[nodiscard]] auto getDirectFileDescriptorCount() const noexcept -> std::uint32_t;
+
+        auto configure(const ContextOptions &options,
+                       std::source_location sourceLocation = std::source_location::current()) -> void;
+
+        [[nodiscard]] auto getRingFileDescriptor() const noexcept -> std::int32_t;
+
+        auto attach(Scheduler *scheduler, std::uint32_t index) noexcept -> void;
 
         auto run(std::source_location sourceLocation = std::source_location::current()) -> void;
 
         auto stop(std::source_location sourceLocation = std::source_location::current()) -> void;
 
-        auto spawn(Coroutine coroutine) -> void;
+        auto spawn(Coroutine coroutine) -> std::uint64_t;
+
+        // pushed to the runtime when attached, the context that resumes it first reserves its id
+        auto spawnBalanced(Coroutine coroutine) -> std::uint64_t;
+
+        [[nodiscard]] auto reserve(Coroutine::Handle handle) -> std::uint64_t;
+
+        auto release(std::uint64_t id) noexcept -> void;
+
+        [[nodiscard]] auto isPending(std::uint64_t id) const noexcept -> bool;
+
+        // a zero-copy send completes under an id of its own, which stays reserved after its sender resumed until the
+        // kernel's notification arrives and runs release
+        [[nodiscard]] auto reserveNotification(std::move_only_function<auto()->void> release) -> std::uint64_t;
+
+        auto bind(std::uint64_t id, Coroutine::Handle handle) noexcept -> void;
+
+        auto notify(std::uint64_t id) -> void;
+
+        auto wake(Coroutine::Handle handle, std::int32_t result) -> void;
+
+        // the scope of the coroutine running right now, which the submissions it takes are bounded by
+        [[nodiscard]] auto getCancellationScope() const noexcept -> CancellationScope *;
+
+        auto setCancellationScope(CancellationScope *cancellationScope) noexcept -> void;
+
+        auto addTimer(Timer &timer, std::chrono::nanoseconds duration) -> void;
+
+        auto removeTimer(Timer &timer) noexcept -> void;
+
+        [[nodiscard]] auto getTimerStatistics() const noexcept -> TimerStatistics;
+
+        [[nodiscard]] auto getId(std::source_location sourceLocation = std::source_location::current()) const
+            -> std::uint32_t;
+
+        // only from a context attached to a runtime, which runs by then; the message goes out with its next submit
+        auto spawnOn(std::uint32_t id, Coroutine coroutine,
+                     std::source_location sourceLocation = std::source_location::current()) -> void;
 
         [[nodiscard]] auto getSubmission() const -> io_uring_sqe *;
 
@@ -35,25 +103,72 @@ namespace coContext::internal {
                                       __kernel_timespec timeSpecification) const -> std::int32_t;
 
     private:
+        [[nodiscard]] static auto makeRing(const ContextOptions &options) -> std::shared_ptr<Ring>;
+
+        static auto configureFrameAllocator(const ContextOptions &options) noexcept -> void;
+
+        auto registerRing() -> void;
+
+        auto setupBufferRings(const ContextOptions &options) -> void;
+
+        auto maintainBufferRings() noexcept -> void;
+
+        auto registerDirectFileDescriptor() -> void;
+
+        auto processCompletions() -> void;
+
+        auto processCompletion(Completion completion) -> void;
+
+        auto processMessageCompletion(Completion completion) -> void;
+
+        auto resumeWokenCoroutines() -> void;
+
+        auto recordTimerWakeup() noexcept -> void;
+
+        auto armTimerWheel(std::chrono::steady_clock::time_point deadline) -> void;
+
+        auto processTimerWheelCompletion() -> void;
+
         auto scheduleUnscheduledCoroutines() -> void;
 
+        auto scheduleQueuedCoroutines() -> void;
+
         auto scheduleCoroutine(Coroutine coroutine) -> void;
 
-        static constexpr std::uint16_t entries{32768};
+        auto resumeCoroutine(Coroutine::Handle handle) -> void;
 
-        std::shared_ptr<Ring> ring{[] constexpr {
-            io_uring_params parameters{};
-            parameters.flags = IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG |
-                               IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN;
+        [[nodiscard]] auto isStopped() const noexcept -> bool;
 
-            return std::allocate_shared<Ring>(std::pmr::polymorphic_allocator{getUnsyncMemoryResource()}, entries,
-                                              std::addressof(parameters));
-        }()};
-        BufferRing bufferRing{ring, entries, 0, IOU_PBUF_RING_INC};
+        static constexpr std::array<std::size_t, 3> bufferSizes{512, 4096, 65536};
+        static constexpr std::array<std::uint32_t, 3> bufferEntries{32768, 8192, 1024};
+        static constexpr std::uint32_t completionBatch{128}, stealBatch{64};
+        static constexpr std::uint32_t spawnFlag{1U << 13};
+        // user data no suspension table id can carry: the bit of a spawnOn message and the timer wheel's timeout
+        static constexpr std::uint64_t messageBit{std::uint64_t{1} << 63}, timerWheelId{std::uint64_t{1} << 62};
+        static_assert((messageBit | timerWheelId) == SuspensionTable::reservedBits);
+
+        std::shared_ptr<Ring> ring;
+        std::pmr::vector<BufferRing> bufferRings{getUnsyncMemoryResource()};
+        std::size_t receiveSize{bufferSizes.front()}, zeroCopyThreshold;
+        FixedBufferPool fixedBufferPool;
+        // declared ahead of every owner of frames, whose timers unlink themselves from it when they are destroyed
+        TimerWheel timerWheel;
         std::pmr::vector<Coroutine> unscheduledCoroutines{getUnsyncMemoryResource()};
-        std::pmr::unordered_map<std::uint64_t, Coroutine> schedulingCoroutines{getUnsyncMemoryResource()};
-        bool isRunning{};
+        std::pmr::vector<Coroutine::Handle> wokenCoroutines{getUnsyncMemoryResource()};
+        SuspensionTable suspensionTable;
+        std::pmr::vector<std::move_only_function<auto()->void>> notifications{getUnsyncMemoryResource()};
+        // min while the wheel has no timeout armed
+        std::chrono::steady_clock::time_point timerWheelDeadline{std::chrono::steady_clock::time_point::min()};
+        __kernel_timespec timerWheelTimeSpecification{};
+        std::uint64_t expiredTimerCount{};
+        TimerStatistics timerStatistics{};
+        CancellationScope *cancellationScope{};
+        Scheduler *scheduler{};
+        std::uint32_t schedulerIndex{}, directFileDescriptorCount;
+        bool isDirectFileDescriptorRegistered{}, isRunning{};
     };
+
+    [[nodiscard]] auto getContext() -> Context &;
 }    // namespace coContext::internal
 
 template<>
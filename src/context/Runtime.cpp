@@ -0,0 +1,58 @@
+#include "coContext/context/Runtime.hpp"
+
+#include "Scheduler.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+coContext::Runtime::Runtime(const std::uint32_t contextCount, const ContextOptions options) :
+    scheduler{std::make_unique<internal::Scheduler>(std::max(contextCount, 1U))}, options{options} {}
+
+coContext::Runtime::Runtime(Runtime &&) noexcept = default;
+
+auto coContext::Runtime::operator=(Runtime &&) noexcept -> Runtime & = default;
+
+coContext::Runtime::~Runtime() = default;
+
+auto coContext::Runtime::swap(Runtime &other) noexcept -> void {
+    std::swap(this->scheduler, other.scheduler);
+    std::swap(this->options, other.options);
+}
+
+auto coContext::Runtime::getContextCount() const noexcept -> std::uint32_t { return this->scheduler->getCount(); }
+
+auto coContext::Runtime::run() -> void {
+    this->scheduler->start();
+
+    // the first exception of any context stops the others and is rethrown here once all of them are joined
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    const auto runContext{[this, &exception, &exceptionMutex](const std::uint32_t index) noexcept {
+        try {
+            internal::run(*this->scheduler, index, this->options);
+        } catch (...) {
+            this->stop();
+
+            const std::lock_guard lock{exceptionMutex};
+            if (!exception) exception = std::current_exception();
+        }
+    }};
+
+    {
+        std::pmr::vector<std::jthread> workers{internal::getSyncMemoryResource()};
+        workers.reserve(this->getContextCount() - 1);
+        for (std::uint32_t i{1}; i != this->getContextCount(); ++i) workers.emplace_back(runContext, i);
+
+        runContext(0);
+    }
+
+    if (exception) std::rethrow_exception(exception);
+}
+
+auto coContext::Runtime::stop() noexcept -> void { this->scheduler->stop(); }
+
+auto coContext::Runtime::spawnCoroutine(internal::Coroutine coroutine) -> void {
+    static_cast<void>(this->scheduler->push(std::move(coroutine)));
+}
@@ -0,0 +1,127 @@
+#include "Scheduler.hpp"
+
+#include "../log/Exception.hpp"
+#include "coContext/coroutine/BasePromise.hpp"
+
+#include <algorithm>
+#include <liburing.h>
+#include <limits>
+
+using namespace std::string_view_literals;
+
+coContext::internal::Scheduler::Worker::Worker(const std::size_t capacity) : queue{capacity} {}
+
+coContext::internal::Scheduler::Scheduler(const std::uint32_t count, const std::size_t capacity) {
+    this->workers.reserve(count);
+    for (std::uint32_t i{}; i != count; ++i) this->workers.emplace_back(std::make_unique<Worker>(capacity));
+}
+
+auto coContext::internal::Scheduler::getCount() const noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(std::size(this->workers));
+}
+
+auto coContext::internal::Scheduler::isRunning() const noexcept -> bool {
+    return this->running.test(std::memory_order::relaxed);
+}
+
+auto coContext::internal::Scheduler::start() noexcept -> void {
+    this->running.test_and_set(std::memory_order::relaxed);
+}
+
+auto coContext::internal::Scheduler::stop() noexcept -> void {
+    this->running.clear(std::memory_order::relaxed);
+
+    for (std::uint32_t i{}; i != this->getCount(); ++i) this->wake(i);
+}
+
+auto coContext::internal::Scheduler::push(Coroutine coroutine, const std::source_location sourceLocation)
+    -> std::uint32_t {
+    const std::uint32_t leastLoadedIndex{this->getLeastLoadedIndex()};
+    for (std::uint32_t i{}; i != this->getCount(); ++i) {
+        const std::uint32_t index{(leastLoadedIndex + i) % this->getCount()};
+        if (Worker &worker{*this->workers[index]}; worker.queue.push(coroutine.get())) {
+            static_cast<void>(coroutine.release());
+
+            // pairs with the fence in park(), either the parking context sees this coroutine or it is seen idle here
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            if (worker.isIdle.load(std::memory_order::relaxed) &&
+                worker.isIdle.exchange(false, std::memory_order::relaxed))
+                this->wake(index);
+
+            return index;
+        }
+    }
+
+    throw Exception{
+        Log{Log::Level::error, std::pmr::string{"work queue is full"sv, getSyncMemoryResource()}, sourceLocation}
+    };
+}
+
+auto coContext::internal::Scheduler::pop(const std::uint32_t index) noexcept -> Coroutine {
+    for (std::uint32_t i{}; i != this->getCount(); ++i) {
+        if (const Coroutine::Handle handle{this->workers[(index + i) % this->getCount()]->queue.pop()}; handle)
+            return Coroutine{handle};
+    }
+
+    return Coroutine{nullptr};
+}
+
+auto coContext::internal::Scheduler::setLoad(const std::uint32_t index, const std::size_t load) noexcept -> void {
+    this->workers[index]->load.store(load, std::memory_order::relaxed);
+}
+
+auto coContext::internal::Scheduler::park(const std::uint32_t index) noexcept -> bool {
+    Worker &worker{*this->workers[index]};
+    worker.isIdle.store(true, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+
+    if (this->isRunning() && !this->hasQueuedCoroutine()) return true;
+
+    worker.isIdle.store(false, std::memory_order::relaxed);
+
+    return false;
+}
+
+auto coContext::internal::Scheduler::unpark(const std::uint32_t index) noexcept -> void {
+    this->workers[index]->isIdle.store(false, std::memory_order::relaxed);
+}
+
+auto coContext::internal::Scheduler::getRingFileDescriptor(const std::uint32_t index) const noexcept -> std::int32_t {
+    return this->workers[index]->ringFileDescriptor.load(std::memory_order::acquire);
+}
+
+auto coContext::internal::Scheduler::setRingFileDescriptor(const std::uint32_t index,
+                                                           const std::int32_t ringFileDescriptor) noexcept -> void {
+    this->workers[index]->ringFileDescriptor.store(ringFileDescriptor, std::memory_order::release);
+}
+
+auto coContext::internal::Scheduler::getLeastLoadedIndex() const noexcept -> std::uint32_t {
+    std::uint32_t leastLoadedIndex{};
+    std::size_t leastLoad{std::numeric_limits<std::size_t>::max()};
+    for (std::uint32_t i{}; i != this->getCount(); ++i) {
+        const Worker &worker{*this->workers[i]};
+        if (const std::size_t load{worker.load.load(std::memory_order::relaxed) + worker.queue.getSize()};
+            load < leastLoad) {
+            leastLoadedIndex = i;
+            leastLoad = load;
+        }
+    }
+
+    return leastLoadedIndex;
+}
+
+auto coContext::internal::Scheduler::hasQueuedCoroutine() const noexcept -> bool {
+    return std::ranges::any_of(this->workers,
+                               [](const std::unique_ptr<Worker> &worker) { return worker->queue.getSize() != 0; });
+}
+
+auto coContext::internal::Scheduler::wake(const std::uint32_t index) const noexcept -> void {
+    const std::int32_t ringFileDescriptor{this->getRingFileDescriptor(index)};
+    if (ringFileDescriptor == -1) return;
+
+    // posted without a ring of the caller's own, so that threads outside the runtime can wake a context as well; a
+    // context that is not running yet drains its queue when it starts, so a failed wake loses nothing
+    io_uring_sqe submission{};
+    io_uring_prep_msg_ring(std::addressof(submission), ringFileDescriptor, 0, BasePromise::invalidId, 0);
+    static_cast<void>(io_uring_register_sync_msg(std::addressof(submission)));
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "WorkQueue.hpp"
+#include "coContext/memory/memoryResource.hpp"
+
+#include <source_location>
+
+namespace coContext::internal {
+    class Scheduler {
+        struct Worker {
+            explicit Worker(std::size_t capacity);
+
+            WorkQueue queue;
+            alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> load;
+            std::atomic<std::int32_t> ringFileDescriptor{-1};
+            std::atomic<bool> isIdle;
+        };
+
+    public:
+        explicit Scheduler(std::uint32_t count, std::size_t capacity = 65536);
+
+        Scheduler(const Scheduler &) = delete;
+
+        auto operator=(const Scheduler &) -> Scheduler & = delete;
+
+        Scheduler(Scheduler &&) noexcept = delete;
+
+        auto operator=(Scheduler &&) noexcept -> Scheduler & = delete;
+
+        ~Scheduler() = default;
+
+        [[nodiscard]] auto getCount() const noexcept -> std::uint32_t;
+
+        [[nodiscard]] auto isRunning() const noexcept -> bool;
+
+        auto start() noexcept -> void;
+
+        auto stop() noexcept -> void;
+
+        auto push(Coroutine coroutine, std::source_location sourceLocation = std::source_location::current())
+            -> std::uint32_t;
+
+        [[nodiscard]] auto pop(std::uint32_t index) noexcept -> Coroutine;
+
+        auto setLoad(std::uint32_t index, std::size_t load) noexcept -> void;
+
+        [[nodiscard]] auto park(std::uint32_t index) noexcept -> bool;
+
+        auto unpark(std::uint32_t index) noexcept -> void;
+
+        [[nodiscard]] auto getRingFileDescriptor(std::uint32_t index) const noexcept -> std::int32_t;
+
+        auto setRingFileDescriptor(std::uint32_t index, std::int32_t ringFileDescriptor) noexcept -> void;
+
+    private:
+        [[nodiscard]] auto getLeastLoadedIndex() const noexcept -> std::uint32_t;
+
+        [[nodiscard]] auto hasQueuedCoroutine() const noexcept -> bool;
+
+        auto wake(std::uint32_t index) const noexcept -> void;
+
+        std::pmr::vector<std::unique_ptr<Worker>> workers{getSyncMemoryResource()};
+        std::atomic_flag running;
+    };
+}    // namespace coContext::internal
@@ -0,0 +1,88 @@
+#include "SuspensionTable.hpp"
+
+#include "coContext/coroutine/BasePromise.hpp"
+
+#include <algorithm>
+#include <functional>
+
+coContext::internal::SuspensionTable::~SuspensionTable() {
+    std::pmr::vector<Coroutine::Handle> handles{getUnsyncMemoryResource()};
+    for (const Slot &slot : this->slots) {
+        if (slot.handle && !slot.handle.promise().getParentCoroutineHandle()) handles.emplace_back(slot.handle);
+    }
+
+    // a sender awaiting a zero-copy send holds a second slot for its notification, each frame is destroyed once
+    std::ranges::sort(handles, std::less{}, [](const Coroutine::Handle handle) { return handle.address(); });
+    const auto [first, last]{std::ranges::unique(handles)};
+    handles.erase(first, last);
+
+    std::pmr::vector<Coroutine> rootCoroutines{getUnsyncMemoryResource()};
+    for (const Coroutine::Handle handle : handles) rootCoroutines.emplace_back(handle);
+}
+
+auto coContext::internal::SuspensionTable::swap(SuspensionTable &other) noexcept -> void {
+    std::swap(this->slots, other.slots);
+    std::swap(this->freeIndexes, other.freeIndexes);
+}
+
+auto coContext::internal::SuspensionTable::reserve(const Coroutine::Handle handle) -> std::uint64_t {
+    if (std::empty(this->freeIndexes)) {
+        this->slots.emplace_back(handle);
+
+        return makeId(static_cast<std::uint32_t>(std::size(this->slots) - 1), 0);
+    }
+
+    const std::uint32_t index{this->freeIndexes.back()};
+    this->freeIndexes.pop_back();
+
+    Slot &slot{this->slots[index]};
+    slot.handle = handle;
+
+    return makeId(index, slot.generation);
+}
+
+auto coContext::internal::SuspensionTable::bind(const std::uint64_t id, const Coroutine::Handle handle) noexcept
+    -> void {
+    if (Slot *const slot{this->findSlot(id)}; slot != nullptr) slot->handle = handle;
+}
+
+auto coContext::internal::SuspensionTable::release(const std::uint64_t id) noexcept -> void {
+    Slot *const slot{this->findSlot(id)};
+    if (slot == nullptr) return;
+
+    slot->handle = nullptr;
+    slot->generation = (slot->generation + 1) & generationMask;
+    this->freeIndexes.emplace_back(static_cast<std::uint32_t>(id));
+}
+
+auto coContext::internal::SuspensionTable::find(const std::uint64_t id) const noexcept -> Coroutine::Handle {
+    const auto index{static_cast<std::uint32_t>(id)};
+    if (index >= std::size(this->slots)) return nullptr;
+
+    const Slot &slot{this->slots[index]};
+
+    return slot.generation == static_cast<std::uint32_t>(id >> 32) ? slot.handle : nullptr;
+}
+
+auto coContext::internal::SuspensionTable::prefetch(const std::uint64_t id) const noexcept -> void {
+    if (const auto index{static_cast<std::uint32_t>(id)}; index < std::size(this->slots))
+        __builtin_prefetch(std::addressof(this->slots[index]));
+}
+
+auto coContext::internal::SuspensionTable::getSize() const noexcept -> std::size_t {
+    return std::size(this->slots) - std::size(this->freeIndexes);
+}
+
+auto coContext::internal::SuspensionTable::makeId(const std::uint32_t index, const std::uint32_t generation) noexcept
+    -> std::uint64_t {
+    return static_cast<std::uint64_t>(generation) << 32 | index;
+}
+
+auto coContext::internal::SuspensionTable::findSlot(const std::uint64_t id) noexcept -> Slot * {
+    const auto index{static_cast<std::uint32_t>(id)};
+    if (index >= std::size(this->slots)) return nullptr;
+
+    Slot &slot{this->slots[index]};
+
+    return slot.generation == static_cast<std::uint32_t>(id >> 32) ? std::addressof(slot) : nullptr;
+}
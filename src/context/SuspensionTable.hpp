@@ -0,0 +1,62 @@
+#pragma once
+
+#include "coContext/coroutine/Coroutine.hpp"
+#include "coContext/memory/memoryResource.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace coContext::internal {
+    class SuspensionTable {
+        struct Slot {
+            Coroutine::Handle handle;
+            std::uint32_t generation{};
+        };
+
+    public:
+        SuspensionTable() = default;
+
+        SuspensionTable(const SuspensionTable &) = delete;
+
+        auto operator=(const SuspensionTable &) -> SuspensionTable & = delete;
+
+        SuspensionTable(SuspensionTable &&) noexcept = default;
+
+        auto operator=(SuspensionTable &&) noexcept -> SuspensionTable & = default;
+
+        ~SuspensionTable();
+
+        auto swap(SuspensionTable &other) noexcept -> void;
+
+        [[nodiscard]] auto reserve(Coroutine::Handle handle) -> std::uint64_t;
+
+        auto bind(std::uint64_t id, Coroutine::Handle handle) noexcept -> void;
+
+        auto release(std::uint64_t id) noexcept -> void;
+
+        [[nodiscard]] auto find(std::uint64_t id) const noexcept -> Coroutine::Handle;
+
+        auto prefetch(std::uint64_t id) const noexcept -> void;
+
+        [[nodiscard]] auto getSize() const noexcept -> std::size_t;
+
+        // the top two bits of an id are never set, which leaves them to the context for tagging submissions of its own
+        static constexpr std::uint64_t reservedBits{std::uint64_t{0b11} << 62};
+
+    private:
+        static constexpr std::uint32_t generationMask{0x3fffffff};
+
+        [[nodiscard]] static auto makeId(std::uint32_t index, std::uint32_t generation) noexcept -> std::uint64_t;
+
+        [[nodiscard]] auto findSlot(std::uint64_t id) noexcept -> Slot *;
+
+        std::pmr::vector<Slot> slots{getUnsyncMemoryResource()};
+        std::pmr::vector<std::uint32_t> freeIndexes{getUnsyncMemoryResource()};
+    };
+}    // namespace coContext::internal
+
+template<>
+constexpr auto std::swap(coContext::internal::SuspensionTable &lhs, coContext::internal::SuspensionTable &rhs) noexcept
+    -> void {
+    lhs.swap(rhs);
+}
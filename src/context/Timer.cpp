@@ -0,0 +1,62 @@
+#include "coContext/context/Timer.hpp"
+
+#include "Context.hpp"
+#include "coContext/coroutine/BasePromise.hpp"
+#include "coContext/coroutine/CancellationScope.hpp"
+
+#include <cerrno>
+#include <utility>
+
+coContext::Timer::~Timer() {
+    if (this->isLinked) internal::getContext().removeTimer(*this);
+    if (this->cancellationScope != nullptr) this->cancellationScope->untrack(*this);
+}
+
+auto coContext::Timer::isArmed() const noexcept -> bool { return this->isLinked; }
+
+auto coContext::Timer::wait(const std::chrono::nanoseconds duration) -> Timer & {
+    this->reset(duration);
+
+    return *this;
+}
+
+auto coContext::Timer::reset(const std::chrono::nanoseconds duration) -> void {
+    this->result = 0;
+
+    internal::getContext().addTimer(*this, duration);
+}
+
+auto coContext::Timer::cancel() -> void {
+    if (!this->isLinked) return;
+
+    internal::getContext().removeTimer(*this);
+    this->expire(-ECANCELED);
+}
+
+auto coContext::Timer::await_ready() const noexcept -> bool { return !this->isLinked; }
+
+auto coContext::Timer::await_suspend(const std::coroutine_handle<> genericCoroutineHandle) -> void {
+    this->coroutineHandle = internal::Coroutine::Handle::from_address(genericCoroutineHandle.address());
+
+    // a cancelled scope wakes the wait the way the kernel completes a cancelled submission
+    if (CancellationScope *const cancellationScope{this->coroutineHandle.promise().getCancellationScope()};
+        cancellationScope != nullptr) {
+        if (cancellationScope->isCancelled()) {
+            this->cancel();
+
+            return;
+        }
+
+        this->cancellationScope = cancellationScope;
+        cancellationScope->track(*this);
+    }
+}
+
+auto coContext::Timer::await_resume() const noexcept -> std::int32_t { return this->result; }
+
+auto coContext::Timer::expire(const std::int32_t result) -> void {
+    this->result = result;
+    if (this->cancellationScope != nullptr) std::exchange(this->cancellationScope, nullptr)->untrack(*this);
+
+    if (this->coroutineHandle) internal::getContext().wake(std::exchange(this->coroutineHandle, nullptr), result);
+}
@@ -0,0 +1,149 @@
+#include "TimerWheel.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <utility>
+
+coContext::internal::TimerWheel::TimerWheel(const std::chrono::nanoseconds tick) noexcept :
+    tick{std::max(tick, std::chrono::nanoseconds{1})} {}
+
+auto coContext::internal::TimerWheel::getTick() const noexcept -> std::chrono::nanoseconds { return this->tick; }
+
+auto coContext::internal::TimerWheel::isEmpty() const noexcept -> bool { return this->count == 0; }
+
+auto coContext::internal::TimerWheel::add(Timer &timer, const std::chrono::nanoseconds duration) noexcept
+    -> std::chrono::steady_clock::time_point {
+    this->remove(timer);
+
+    const std::uint64_t nowTick{this->getNowTick()};
+    if (this->count == 0) this->currentTick = nowTick;
+
+    const auto ticks{static_cast<std::uint64_t>((duration + this->tick - std::chrono::nanoseconds{1}) / this->tick)};
+    timer.expiry = nowTick + std::max(ticks, std::uint64_t{1});
+
+    this->link(timer);
+    ++this->count;
+
+    return this->getTime(timer.expiry);
+}
+
+auto coContext::internal::TimerWheel::remove(Timer &timer) noexcept -> void {
+    if (!timer.isLinked) return;
+
+    if (timer.previous != nullptr) timer.previous->next = timer.next;
+    else this->slots[timer.slot] = timer.next;
+    if (timer.next != nullptr) timer.next->previous = timer.previous;
+
+    timer.previous = nullptr;
+    timer.next = nullptr;
+    timer.isLinked = false;
+    --this->count;
+}
+
+auto coContext::internal::TimerWheel::advance() -> std::size_t {
+    const std::uint64_t nowTick{this->getNowTick()};
+
+    std::size_t expiredCount{};
+    while (this->count != 0 && this->currentTick < nowTick) {
+        // the ticks in between have nothing linked to them, so a long sleep or stall costs one step per event
+        const std::uint64_t nextTick{this->getNextTick()};
+        if (nextTick > nowTick) break;
+
+        this->currentTick = nextTick;
+
+        for (std::uint32_t level{1}; level != levelCount; ++level) {
+            if ((this->currentTick & ((std::uint64_t{1} << (levelBits * level)) - 1)) != 0) break;
+
+            this->relink(level * slotCount + ((this->currentTick >> (levelBits * level)) & slotMask));
+        }
+
+        expiredCount += this->expire(this->currentTick & slotMask);
+    }
+
+    this->currentTick = std::max(this->currentTick, nowTick);
+
+    return expiredCount;
+}
+
+auto coContext::internal::TimerWheel::getNextExpiry() const noexcept
+    -> std::optional<std::chrono::steady_clock::time_point> {
+    if (this->count == 0) return std::nullopt;
+
+    return this->getTime(this->getNextTick());
+}
+
+auto coContext::internal::TimerWheel::getNowTick() const noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>((coContext::now() - this->start) / this->tick);
+}
+
+auto coContext::internal::TimerWheel::getNextTick() const noexcept -> std::uint64_t {
+    std::uint64_t nextTick{std::numeric_limits<std::uint64_t>::max()};
+    for (std::uint32_t level{}; level != levelCount; ++level) {
+        // a level is only visited at the ticks that are a multiple of its slot width
+        const std::uint32_t shift{levelBits * level};
+        const std::uint64_t first{(this->currentTick >> shift) + 1};
+        for (std::uint64_t position{first}; position != first + slotCount; ++position) {
+            if (this->slots[level * slotCount + (position & slotMask)] == nullptr) continue;
+
+            nextTick = std::min(nextTick, position << shift);
+            break;
+        }
+    }
+
+    return nextTick;
+}
+
+auto coContext::internal::TimerWheel::getTime(const std::uint64_t tick) const noexcept
+    -> std::chrono::steady_clock::time_point {
+    return this->start + static_cast<std::int64_t>(tick) * this->tick;
+}
+
+auto coContext::internal::TimerWheel::link(Timer &timer) noexcept -> void {
+    const std::uint64_t delta{timer.expiry > this->currentTick ? timer.expiry - this->currentTick : 0};
+
+    std::uint32_t level{};
+    while (level != levelCount - 1 && (delta >> (levelBits * (level + 1))) != 0) ++level;
+
+    const std::uint64_t position{(delta >> (levelBits * levelCount)) == 0 ?
+                                     timer.expiry :
+                                     this->currentTick + (std::uint64_t{1} << (levelBits * levelCount)) - 1};
+    const auto slot{static_cast<std::uint16_t>(level * slotCount + ((position >> (levelBits * level)) & slotMask))};
+
+    timer.previous = nullptr;
+    timer.next = this->slots[slot];
+    if (timer.next != nullptr) timer.next->previous = std::addressof(timer);
+    this->slots[slot] = std::addressof(timer);
+    timer.slot = slot;
+    timer.isLinked = true;
+}
+
+auto coContext::internal::TimerWheel::relink(const std::uint32_t slot) noexcept -> void {
+    for (Timer *timer{std::exchange(this->slots[slot], nullptr)}; timer != nullptr;) {
+        Timer *const next{timer->next};
+        this->link(*timer);
+        timer = next;
+    }
+}
+
+auto coContext::internal::TimerWheel::expire(const std::uint32_t slot) -> std::size_t {
+    std::size_t expiredCount{};
+    for (Timer *timer{std::exchange(this->slots[slot], nullptr)}; timer != nullptr;) {
+        Timer *const next{timer->next};
+
+        if (timer->expiry > this->currentTick) this->link(*timer);
+        else {
+            timer->previous = nullptr;
+            timer->next = nullptr;
+            timer->isLinked = false;
+            --this->count;
+            ++expiredCount;
+
+            timer->expire(-ETIME);
+        }
+
+        timer = next;
+    }
+
+    return expiredCount;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "coContext/context/Clock.hpp"
+#include "coContext/context/Timer.hpp"
+
+#include <array>
+#include <optional>
+
+namespace coContext::internal {
+    // four levels of 256 slots cascading into each other, which covers 2^32 ticks; later expiries wait in the last
+    // level and are relinked until they come into range
+    class TimerWheel {
+    public:
+        explicit TimerWheel(std::chrono::nanoseconds tick = std::chrono::milliseconds{1}) noexcept;
+
+        [[nodiscard]] auto getTick() const noexcept -> std::chrono::nanoseconds;
+
+        [[nodiscard]] auto isEmpty() const noexcept -> bool;
+
+        auto add(Timer &timer, std::chrono::nanoseconds duration) noexcept -> std::chrono::steady_clock::time_point;
+
+        auto remove(Timer &timer) noexcept -> void;
+
+        auto advance() -> std::size_t;
+
+        // the earliest tick that expires a timer or cascades a level, nothing needs the wheel advanced before it
+        [[nodiscard]] auto getNextExpiry() const noexcept -> std::optional<std::chrono::steady_clock::time_point>;
+
+    private:
+        static constexpr std::uint32_t levelBits{8}, levelCount{4}, slotCount{1U << levelBits},
+            slotMask{slotCount - 1};
+
+        [[nodiscard]] auto getNowTick() const noexcept -> std::uint64_t;
+
+        // the next tick after the current one that finds a slot to expire or to cascade, max when there is none
+        [[nodiscard]] auto getNextTick() const noexcept -> std::uint64_t;
+
+        [[nodiscard]] auto getTime(std::uint64_t tick) const noexcept -> std::chrono::steady_clock::time_point;
+
+        auto link(Timer &timer) noexcept -> void;
+
+        auto relink(std::uint32_t slot) noexcept -> void;
+
+        auto expire(std::uint32_t slot) -> std::size_t;
+
+        std::array<Timer *, levelCount * slotCount> slots{};
+        std::chrono::steady_clock::time_point start{coContext::now()};
+        std::chrono::nanoseconds tick;
+        std::uint64_t currentTick{};
+        std::size_t count{};
+    };
+}    // namespace coContext::internal
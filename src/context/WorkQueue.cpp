@@ -0,0 +1,57 @@
+#include "WorkQueue.hpp"
+
+#include <bit>
+
+coContext::internal::WorkQueue::WorkQueue(const std::size_t capacity) :
+    cells{std::make_unique<Cell[]>(std::bit_ceil(capacity))}, mask{std::bit_ceil(capacity) - 1} {
+    for (std::size_t i{}; i <= this->mask; ++i) this->cells[i].sequence.store(i, std::memory_order::relaxed);
+}
+
+coContext::internal::WorkQueue::~WorkQueue() {
+    for (Coroutine::Handle handle{this->pop()}; handle; handle = this->pop()) handle.destroy();
+}
+
+auto coContext::internal::WorkQueue::push(const Coroutine::Handle handle) noexcept -> bool {
+    std::size_t position{this->pushPosition.load(std::memory_order::relaxed)};
+    while (true) {
+        Cell &cell{this->cells[position & this->mask]};
+
+        const std::size_t sequence{cell.sequence.load(std::memory_order::acquire)};
+        if (const auto difference{static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position)};
+            difference == 0) {
+            if (this->pushPosition.compare_exchange_weak(position, position + 1, std::memory_order::relaxed)) {
+                cell.handle = handle;
+                cell.sequence.store(position + 1, std::memory_order::release);
+
+                return true;
+            }
+        } else if (difference < 0) return false;
+        else position = this->pushPosition.load(std::memory_order::relaxed);
+    }
+}
+
+auto coContext::internal::WorkQueue::pop() noexcept -> Coroutine::Handle {
+    std::size_t position{this->popPosition.load(std::memory_order::relaxed)};
+    while (true) {
+        Cell &cell{this->cells[position & this->mask]};
+
+        const std::size_t sequence{cell.sequence.load(std::memory_order::acquire)};
+        if (const auto difference{static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1)};
+            difference == 0) {
+            if (this->popPosition.compare_exchange_weak(position, position + 1, std::memory_order::relaxed)) {
+                const Coroutine::Handle handle{cell.handle};
+                cell.sequence.store(position + this->mask + 1, std::memory_order::release);
+
+                return handle;
+            }
+        } else if (difference < 0) return nullptr;
+        else position = this->popPosition.load(std::memory_order::relaxed);
+    }
+}
+
+auto coContext::internal::WorkQueue::getSize() const noexcept -> std::size_t {
+    const std::size_t pushPosition{this->pushPosition.load(std::memory_order::relaxed)},
+        popPosition{this->popPosition.load(std::memory_order::relaxed)};
+
+    return pushPosition > popPosition ? pushPosition - popPosition : 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "coContext/coroutine/Coroutine.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace coContext::internal {
+    class WorkQueue {
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            Coroutine::Handle handle;
+        };
+
+    public:
+        explicit WorkQueue(std::size_t capacity);
+
+        WorkQueue(const WorkQueue &) = delete;
+
+        auto operator=(const WorkQueue &) -> WorkQueue & = delete;
+
+        WorkQueue(WorkQueue &&) noexcept = delete;
+
+        auto operator=(WorkQueue &&) noexcept -> WorkQueue & = delete;
+
+        ~WorkQueue();
+
+        [[nodiscard]] auto push(Coroutine::Handle handle) noexcept -> bool;
+
+        [[nodiscard]] auto pop() noexcept -> Coroutine::Handle;
+
+        [[nodiscard]] auto getSize() const noexcept -> std::size_t;
+
+    private:
+        std::unique_ptr<Cell[]> cells;
+        std::size_t mask;
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> pushPosition;
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> popPosition;
+    };
+}    // namespace coContext::internal
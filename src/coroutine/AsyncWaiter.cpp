@@ -1,25 +1,123 @@
 #include "coContext/coroutine/AsyncWaiter.hpp"
 
+#include "../context/Context.hpp"
 #include "coContext/coroutine/BasePromise.hpp"
+#include "../log/Exception.hpp"
+#include "coContext/coroutine/CancellationScope.hpp"
 
-coContext::internal::AsyncWaiter::AsyncWaiter(const Submission submission) noexcept : submission{submission} {}
+#include "coContext/context/Clock.hpp"
+
+#include <cerrno>
+#include <ctime>
+#include <format>
+
+using namespace std::string_view_literals;
+
+namespace {
+    // where a timeout expires on the cached monotonic clock, the other clocks are mapped onto it by their distance
+    [[nodiscard]] auto getDeadline(const __kernel_timespec timeSpecification, const std::uint32_t flags) noexcept
+        -> std::chrono::steady_clock::time_point {
+        const std::chrono::nanoseconds time{std::chrono::seconds{timeSpecification.tv_sec} +
+                                            std::chrono::nanoseconds{timeSpecification.tv_nsec}};
+        if ((flags & IORING_TIMEOUT_ABS) == 0) return coContext::now() + time;
+
+        switch (flags & IORING_TIMEOUT_CLOCK_MASK) {
+            case IORING_TIMEOUT_BOOTTIME: {
+                timespec now{};
+                clock_gettime(CLOCK_BOOTTIME, std::addressof(now));
+
+                return coContext::now() + time -
+                       (std::chrono::seconds{now.tv_sec} + std::chrono::nanoseconds{now.tv_nsec});
+            }
+            case IORING_TIMEOUT_REALTIME:
+                return coContext::now() + time - coContext::wallNow().time_since_epoch();
+            default:
+                return std::chrono::steady_clock::time_point{time};
+        }
+    }
+
+    [[nodiscard]] auto toTimeSpecification(const std::chrono::steady_clock::time_point time) noexcept
+        -> __kernel_timespec {
+        const std::chrono::nanoseconds sinceEpoch{time.time_since_epoch()};
+
+        return __kernel_timespec{std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch).count(),
+                                 (sinceEpoch % std::chrono::seconds{1}).count()};
+    }
+}    // namespace
+
+coContext::internal::AsyncWaiter::AsyncWaiter(const Submission submission) : submission{submission} {
+    // a multishot request outlives any deadline and a cancellation or an update acts on requests of its own
+    const CancellationScope *const cancellationScope{getContext().getCancellationScope()};
+    if (cancellationScope == nullptr || !submission.isSingleShot()) return;
+
+    if (const std::optional timeSpecification{cancellationScope->getLinkTimeout()}; timeSpecification)
+        this->setLinkTimeout(*timeSpecification, IORING_TIMEOUT_ABS);
+}
 
 auto coContext::internal::AsyncWaiter::swap(AsyncWaiter &other) noexcept -> void {
     std::swap(this->submission, other.submission);
+    std::swap(this->linkTimeout, other.linkTimeout);
     std::swap(this->coroutineHandle, other.coroutineHandle);
     std::swap(this->timeSpecification, other.timeSpecification);
+    std::swap(this->linkTimeSpecification, other.linkTimeSpecification);
+    std::swap(this->notificationId, other.notificationId);
+    std::swap(this->linkTimeoutFlags, other.linkTimeoutFlags);
+    std::swap(this->isTimeSpecification, other.isTimeSpecification);
+    std::swap(this->isLinkTimeout, other.isLinkTimeout);
+    std::swap(this->isDirectAllocation, other.isDirectAllocation);
+    std::swap(this->isNotification, other.isNotification);
 }
 
 auto coContext::internal::AsyncWaiter::getSubmission() const noexcept -> Submission { return this->submission; }
 
-auto coContext::internal::AsyncWaiter::getTimeSpecification() const noexcept
-    -> const std::unique_ptr<__kernel_timespec> & {
-    return this->timeSpecification;
+auto coContext::internal::AsyncWaiter::addFlags(std::uint32_t flags) const noexcept -> void {
+    if (this->isLinkTimeout && (flags & IOSQE_IO_LINK) != 0) {
+        this->linkTimeout.addFlags(IOSQE_IO_LINK);
+        flags &= ~IOSQE_IO_LINK;
+    }
+
+    this->submission.addFlags(flags);
+}
+
+auto coContext::internal::AsyncWaiter::setTimeSpecification(const __kernel_timespec timeSpecification) noexcept
+    -> void {
+    this->timeSpecification = timeSpecification;
+    this->isTimeSpecification = true;
+}
+
+auto coContext::internal::AsyncWaiter::setLinkTimeout(__kernel_timespec timeSpecification, std::uint32_t flags)
+    -> void {
+    if (this->isLinkTimeout) {
+        // a marker narrows the deadline of a scope but never extends it
+        const std::chrono::steady_clock::time_point deadline{getDeadline(timeSpecification, flags)};
+        if (getDeadline(this->linkTimeSpecification, this->linkTimeoutFlags) <= deadline) return;
+
+        // a relative timeout would count from the submission instead of from the time it was compared at
+        if ((flags & (IORING_TIMEOUT_ABS | IORING_TIMEOUT_CLOCK_MASK)) == 0) {
+            timeSpecification = toTimeSpecification(deadline);
+            flags |= IORING_TIMEOUT_ABS;
+        }
+
+        this->linkTimeSpecification = timeSpecification;
+        this->linkTimeoutFlags = flags;
+        this->linkTimeout.setTimeoutFlags(flags);
+
+        return;
+    }
+
+    this->linkTimeSpecification = timeSpecification;
+    this->linkTimeoutFlags = flags;
+    this->submission.addFlags(IOSQE_IO_LINK);
+    this->linkTimeout = Submission::linkTimeout(getContext().getSubmission(), nullptr, flags);
+    this->linkTimeout.setUserData(BasePromise::invalidId);
+    this->isLinkTimeout = true;
 }
 
-auto coContext::internal::AsyncWaiter::setTimeSpecification(
-    std::unique_ptr<__kernel_timespec> timeSpecification) noexcept -> void {
-    this->timeSpecification = std::move(timeSpecification);
+auto coContext::internal::AsyncWaiter::setDirectAllocation() noexcept -> void { this->isDirectAllocation = true; }
+
+auto coContext::internal::AsyncWaiter::setNotification(std::move_only_function<auto()->void> release) -> void {
+    this->notificationId = getContext().reserveNotification(std::move(release));
+    this->isNotification = true;
 }
 
 auto coContext::internal::AsyncWaiter::await_ready() const noexcept -> bool { return {}; }
@@ -29,11 +127,47 @@ auto coContext::internal::AsyncWaiter::await_suspend(const std::coroutine_handle
     if (this->coroutineHandle == genericCoroutineHandle) return;
 
     this->coroutineHandle = Coroutine::Handle::from_address(genericCoroutineHandle.address());
-    this->submission.setUserData(std::hash<Coroutine::Handle>{}(this->coroutineHandle));
+
+    BasePromise &promise{this->coroutineHandle.promise()};
+    if (promise.getId() == BasePromise::invalidId) promise.setId(getContext().reserve(this->coroutineHandle));
+
+    std::uint64_t id{promise.getId()};
+    if (this->isNotification) {
+        id = this->notificationId;
+        getContext().bind(id, this->coroutineHandle);
+    }
+
+    this->submission.setUserData(id);
+
+    if (CancellationScope *const cancellationScope{promise.getCancellationScope()}; cancellationScope != nullptr)
+        cancellationScope->track(id);
+
+    // both are read by the kernel when the submissions are, by then this waiter has reached its final address
+    if (this->isTimeSpecification) this->submission.setTimeSpecification(std::addressof(this->timeSpecification));
+    if (this->isLinkTimeout) this->linkTimeout.setTimeSpecification(std::addressof(this->linkTimeSpecification));
 }
 
 auto coContext::internal::AsyncWaiter::await_resume() const -> std::int32_t {
-    return this->coroutineHandle.promise().getResult();
+    const std::int32_t result{this->coroutineHandle.promise().getResult()};
+
+    // a send that produced no notification is done with its buffer now, otherwise the slot stays for the notification
+    if (this->isNotification) {
+        if ((this->getResumeFlags() & IORING_CQE_F_MORE) == 0) getContext().notify(this->notificationId);
+        else getContext().bind(this->notificationId, nullptr);
+    }
+
+    // the table never grows, so running out of it is a configuration error rather than a transient one
+    if (result == -ENFILE && this->isDirectAllocation) [[unlikely]] {
+        throw Exception{
+            Log{Log::Level::error,
+                std::pmr::string{std::format("direct descriptor table is full, all {} entries are in use, raise "
+                                             "ContextOptions::directFileDescriptorCount or RLIMIT_NOFILE"sv,
+                                             getContext().getDirectFileDescriptorCount()),
+                                 getSyncMemoryResource()}}
+        };
+    }
+
+    return result;
 }
 
 auto coContext::internal::AsyncWaiter::getResumeFlags() const -> std::uint32_t {
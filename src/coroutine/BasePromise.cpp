@@ -1,19 +1,35 @@
 #include "coContext/coroutine/BasePromise.hpp"
 
+#include "../context/Context.hpp"
+#include "../memory/FrameAllocator.hpp"
+
 auto coContext::internal::BasePromise::operator new(const std::size_t bytes) -> void * {
-    return getUnsyncMemoryResource()->allocate(bytes);
+    std::pmr::memory_resource *const resource{getFrameMemoryResource()};
+
+    auto *const pointer{static_cast<std::byte *>(resource != nullptr ? resource->allocate(headerSize + bytes) :
+                                                                        getFrameAllocator().allocate(headerSize + bytes))};
+    *reinterpret_cast<std::pmr::memory_resource **>(pointer) = resource;
+
+    return pointer + headerSize;
 }
 
 auto coContext::internal::BasePromise::operator delete(void *const pointer, const std::size_t bytes) noexcept -> void {
-    getUnsyncMemoryResource()->deallocate(pointer, bytes);
+    auto *const header{static_cast<std::byte *>(pointer) - headerSize};
+
+    if (std::pmr::memory_resource *const resource{*reinterpret_cast<std::pmr::memory_resource **>(header)};
+        resource != nullptr)
+        resource->deallocate(header, headerSize + bytes);
+    else getFrameAllocator().deallocate(header, headerSize + bytes);
 }
 
 auto coContext::internal::BasePromise::swap(BasePromise &other) noexcept -> void {
     std::swap(this->result, other.result);
     std::swap(this->flags, other.flags);
     std::swap(this->exception, other.exception);
-    std::swap(this->parentCoroutineId, other.parentCoroutineId);
-    std::swap(this->childCoroutine, other.childCoroutine);
+    std::swap(this->id, other.id);
+    std::swap(this->parentCoroutineHandle, other.parentCoroutineHandle);
+    std::swap(this->childCoroutineHandle, other.childCoroutineHandle);
+    std::swap(this->cancellationScope, other.cancellationScope);
 }
 
 auto coContext::internal::BasePromise::getResult() const noexcept -> std::int32_t { return this->result; }
@@ -24,28 +40,61 @@ auto coContext::internal::BasePromise::getFlags() const noexcept -> std::uint32_
 
 auto coContext::internal::BasePromise::setFlags(const std::uint32_t flags) noexcept -> void { this->flags = flags; }
 
-auto coContext::internal::BasePromise::getException() const noexcept -> const std::shared_ptr<std::exception_ptr> & {
+auto coContext::internal::BasePromise::getException() const noexcept -> const std::exception_ptr & {
     return this->exception;
 }
 
-auto coContext::internal::BasePromise::getParentCoroutineId() const noexcept -> std::uint64_t {
-    return this->parentCoroutineId;
+auto coContext::internal::BasePromise::getId() const noexcept -> std::uint64_t { return this->id; }
+
+auto coContext::internal::BasePromise::setId(const std::uint64_t id) noexcept -> void { this->id = id; }
+
+auto coContext::internal::BasePromise::getParentCoroutineHandle() const noexcept -> Coroutine::Handle {
+    return this->parentCoroutineHandle;
+}
+
+auto coContext::internal::BasePromise::setParentCoroutineHandle(const Coroutine::Handle handle) noexcept -> void {
+    this->parentCoroutineHandle = handle;
+}
+
+auto coContext::internal::BasePromise::getChildCoroutineHandle() const noexcept -> Coroutine::Handle {
+    return this->childCoroutineHandle;
 }
 
-auto coContext::internal::BasePromise::setParentCoroutineId(const std::uint64_t id) noexcept -> void {
-    this->parentCoroutineId = id;
+auto coContext::internal::BasePromise::setChildCoroutineHandle(const Coroutine::Handle handle) noexcept -> void {
+    this->childCoroutineHandle = handle;
 }
 
-auto coContext::internal::BasePromise::getChildCoroutine() noexcept -> Coroutine & { return this->childCoroutine; }
+auto coContext::internal::BasePromise::getCancellationScope() const noexcept -> CancellationScope * {
+    return this->cancellationScope;
+}
 
-auto coContext::internal::BasePromise::setChildCoroutine(Coroutine coroutine) noexcept -> void {
-    this->childCoroutine = std::move(coroutine);
+auto coContext::internal::BasePromise::setCancellationScope(CancellationScope *const cancellationScope) noexcept
+    -> void {
+    this->cancellationScope = cancellationScope;
 }
 
 auto coContext::internal::BasePromise::initial_suspend() const noexcept -> std::suspend_always { return {}; }
 
-auto coContext::internal::BasePromise::final_suspend() const noexcept -> std::suspend_always { return {}; }
+auto coContext::internal::BasePromise::final_suspend() const noexcept -> FinalAwaiter { return {}; }
 
-auto coContext::internal::BasePromise::unhandled_exception() const noexcept -> void {
-    *this->exception = std::current_exception();
+auto coContext::internal::BasePromise::unhandled_exception() noexcept -> void {
+    this->exception = std::current_exception();
 }
+
+auto coContext::internal::BasePromise::FinalAwaiter::await_ready() const noexcept -> bool { return {}; }
+
+auto coContext::internal::BasePromise::FinalAwaiter::await_suspend(
+    const std::coroutine_handle<> genericCoroutineHandle) const noexcept -> std::coroutine_handle<> {
+    BasePromise &promise{Coroutine::Handle::from_address(genericCoroutineHandle.address()).promise()};
+    if (promise.getId() != invalidId) getContext().release(promise.getId());
+
+    const Coroutine::Handle parentCoroutineHandle{promise.getParentCoroutineHandle()};
+    if (!parentCoroutineHandle) return std::noop_coroutine();
+
+    parentCoroutineHandle.promise().setChildCoroutineHandle(nullptr);
+    getContext().setCancellationScope(parentCoroutineHandle.promise().getCancellationScope());
+
+    return parentCoroutineHandle;
+}
+
+auto coContext::internal::BasePromise::FinalAwaiter::await_resume() const noexcept -> void {}
@@ -1,26 +1,38 @@
 #include "coContext/coroutine/BaseTask.hpp"
 
+#include "../context/Context.hpp"
 #include "coContext/coroutine/BasePromise.hpp"
+#include "coContext/coroutine/CancellationScope.hpp"
 
 auto coContext::internal::BaseTask::swap(BaseTask &other) noexcept -> void {
     std::swap(this->coroutine, other.coroutine);
-    std::swap(this->exception, other.exception);
 }
 
 auto coContext::internal::BaseTask::getCoroutine() noexcept -> Coroutine & { return this->coroutine; }
 
 auto coContext::internal::BaseTask::throwException() const -> void {
-    if (const std::exception_ptr exception{*this->exception}; exception) std::rethrow_exception(exception);
+    if (const std::exception_ptr &exception{this->coroutine.getPromise().getException()}; exception)
+        std::rethrow_exception(exception);
 }
 
 auto coContext::internal::BaseTask::await_ready() const noexcept -> bool { return {}; }
 
-auto coContext::internal::BaseTask::await_suspend(const std::coroutine_handle<> genericCoroutineHandle) -> void {
+auto coContext::internal::BaseTask::await_suspend(const std::coroutine_handle<> genericCoroutineHandle) const noexcept
+    -> std::coroutine_handle<> {
     const auto parentCoroutineHandle{Coroutine::Handle::from_address(genericCoroutineHandle.address())};
+    const Coroutine::Handle childCoroutineHandle{this->coroutine.get()};
 
-    this->coroutine.getPromise().setParentCoroutineId(std::hash<Coroutine::Handle>{}(parentCoroutineHandle));
-    parentCoroutineHandle.promise().setChildCoroutine(std::move(this->coroutine));
+    childCoroutineHandle.promise().setParentCoroutineHandle(parentCoroutineHandle);
+    parentCoroutineHandle.promise().setChildCoroutineHandle(childCoroutineHandle);
+
+    if (CancellationScope *const parentScope{parentCoroutineHandle.promise().getCancellationScope()}; parentScope) {
+        if (CancellationScope *const childScope{childCoroutineHandle.promise().getCancellationScope()}; !childScope)
+            childCoroutineHandle.promise().setCancellationScope(parentScope);
+        else if (childScope != parentScope && childScope->getParent() == nullptr) childScope->setParent(parentScope);
+    }
+    getContext().setCancellationScope(childCoroutineHandle.promise().getCancellationScope());
+
+    return childCoroutineHandle;
 }
 
-coContext::internal::BaseTask::BaseTask(Coroutine coroutine, std::shared_ptr<std::exception_ptr> exception) noexcept :
-    coroutine{std::move(coroutine)}, exception{std::move(exception)} {}
+coContext::internal::BaseTask::BaseTask(Coroutine coroutine) noexcept : coroutine{std::move(coroutine)} {}
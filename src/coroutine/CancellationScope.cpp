@@ -0,0 +1,95 @@
+#include "coContext/coroutine/CancellationScope.hpp"
+
+#include "../context/Context.hpp"
+#include "coContext/context/Clock.hpp"
+#include "coContext/context/Timer.hpp"
+
+#include <algorithm>
+
+coContext::CancellationScope::CancellationScope(const std::chrono::nanoseconds timeout) :
+    deadline{coContext::now() + timeout} {}
+
+coContext::CancellationScope::CancellationScope(const Clock::time_point deadline) noexcept : deadline{deadline} {}
+
+coContext::CancellationScope::~CancellationScope() {
+    // the timers stay tracked by the outer scopes, which they untrack themselves from through the parent
+    for (Timer *const timer : this->timers) {
+        if (timer->cancellationScope == this) timer->cancellationScope = this->parent;
+    }
+}
+
+auto coContext::CancellationScope::getDeadline() const noexcept -> Clock::time_point {
+    Clock::time_point deadline{this->deadline};
+    for (const CancellationScope *scope{this->parent}; scope != nullptr; scope = scope->parent)
+        deadline = std::min(deadline, scope->deadline);
+
+    return deadline;
+}
+
+auto coContext::CancellationScope::isCancelled() const noexcept -> bool {
+    for (const CancellationScope *scope{this}; scope != nullptr; scope = scope->parent) {
+        if (scope->isCancelRequested) return true;
+    }
+
+    return false;
+}
+
+auto coContext::CancellationScope::cancel() -> void {
+    this->isCancelRequested = true;
+
+    internal::Context &context{internal::getContext()};
+    for (const std::uint64_t id : this->ids) {
+        if (!context.isPending(id)) continue;
+
+        const internal::Submission submission{
+            internal::Submission::cancel(context.getSubmission(), id, IORING_ASYNC_CANCEL_ALL)};
+        submission.setUserData(internal::BasePromise::invalidId);
+    }
+    this->ids.clear();
+
+    std::pmr::vector<Timer *> timers{internal::getUnsyncMemoryResource()};
+    std::swap(timers, this->timers);
+    for (Timer *const timer : timers) timer->cancel();
+}
+
+auto coContext::CancellationScope::getParent() const noexcept -> CancellationScope * { return this->parent; }
+
+auto coContext::CancellationScope::setParent(CancellationScope *const parent) noexcept -> void {
+    this->parent = parent;
+}
+
+auto coContext::CancellationScope::getLinkTimeout() const noexcept -> std::optional<__kernel_timespec> {
+    // an absolute time of zero has already passed, so the submissions of a cancelled scope are cancelled right away
+    if (this->isCancelled()) return __kernel_timespec{};
+
+    const Clock::time_point deadline{this->getDeadline()};
+    if (deadline == Clock::time_point::max()) return std::nullopt;
+
+    const std::chrono::nanoseconds time{deadline.time_since_epoch()};
+
+    return __kernel_timespec{std::chrono::duration_cast<std::chrono::seconds>(time).count(),
+                             (time % std::chrono::seconds{1}).count()};
+}
+
+auto coContext::CancellationScope::track(const std::uint64_t id) -> void {
+    const internal::Context &context{internal::getContext()};
+
+    for (CancellationScope *scope{this}; scope != nullptr; scope = scope->parent) {
+        std::pmr::vector<std::uint64_t> &ids{scope->ids};
+        if (!std::empty(ids) && ids.back() == id) continue;
+
+        if (std::size(ids) == ids.capacity())
+            std::erase_if(ids, [&context](const std::uint64_t trackedId) { return !context.isPending(trackedId); });
+        ids.emplace_back(id);
+    }
+}
+
+auto coContext::CancellationScope::track(Timer &timer) -> void {
+    for (CancellationScope *scope{this}; scope != nullptr; scope = scope->parent)
+        scope->timers.emplace_back(std::addressof(timer));
+}
+
+auto coContext::CancellationScope::untrack(Timer &timer) noexcept -> void {
+    for (CancellationScope *scope{this}; scope != nullptr; scope = scope->parent)
+        std::erase(scope->timers, std::addressof(timer));
+}
@@ -26,6 +26,8 @@ auto coContext::internal::Coroutine::swap(Coroutine &other) noexcept -> void { s
 
 auto coContext::internal::Coroutine::get() const noexcept -> Handle { return this->handle; }
 
+auto coContext::internal::Coroutine::release() noexcept -> Handle { return std::exchange(this->handle, nullptr); }
+
 coContext::internal::Coroutine::operator bool() const noexcept { return static_cast<bool>(this->handle); }
 
 auto coContext::internal::Coroutine::getPromise() const -> BasePromise & { return this->handle.promise(); }
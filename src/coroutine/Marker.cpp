@@ -2,36 +2,54 @@
 
 #include "coContext/coroutine/AsyncWaiter.hpp"
 
-coContext::internal::Marker::Marker(const std::uint32_t flags, Action action) noexcept :
-    flags{flags}, action{std::move(action)} {}
+coContext::internal::Marker::Marker(const std::uint32_t flags) noexcept : flags{flags} {}
+
+coContext::internal::Marker::Marker(const std::uint32_t flags, const __kernel_timespec timeSpecification,
+                                    const std::uint32_t timeoutFlags) noexcept :
+    timeSpecification{timeSpecification}, flags{flags}, timeoutFlags{timeoutFlags}, isLinkTimeout{true} {}
 
 auto coContext::internal::Marker::swap(Marker &other) noexcept -> void {
+    std::swap(this->timeSpecification, other.timeSpecification);
     std::swap(this->flags, other.flags);
-    std::swap(this->action, other.action);
+    std::swap(this->timeoutFlags, other.timeoutFlags);
+    std::swap(this->isLinkTimeout, other.isLinkTimeout);
 }
 
 auto coContext::internal::Marker::getFlags() const noexcept -> std::uint32_t { return this->flags; }
 
-auto coContext::internal::Marker::getAction() noexcept -> Action & { return this->action; }
-
 auto coContext::internal::Marker::addFlags(const std::uint32_t flags) noexcept -> void { this->flags |= flags; }
 
-auto coContext::internal::Marker::setAction(Action action) noexcept -> void { this->action = std::move(action); }
+auto coContext::internal::Marker::hasLinkTimeout() const noexcept -> bool { return this->isLinkTimeout; }
+
+auto coContext::internal::Marker::getTimeSpecification() const noexcept -> __kernel_timespec {
+    return this->timeSpecification;
+}
+
+auto coContext::internal::Marker::getTimeoutFlags() const noexcept -> std::uint32_t { return this->timeoutFlags; }
 
-auto coContext::internal::Marker::executeAction() const -> void {
-    if (this->action) this->action();
+auto coContext::internal::Marker::setLinkTimeout(const __kernel_timespec timeSpecification,
+                                                 const std::uint32_t timeoutFlags) noexcept -> void {
+    this->timeSpecification = timeSpecification;
+    this->timeoutFlags = timeoutFlags;
+    this->isLinkTimeout = true;
 }
 
-auto coContext::internal::operator|(Marker lhs, Marker rhs) noexcept -> Marker {
+auto coContext::internal::operator|(Marker lhs, const Marker &rhs) noexcept -> Marker {
     lhs.addFlags(rhs.getFlags());
-    lhs.setAction(std::move(rhs.getAction()));
+    if (rhs.hasLinkTimeout()) lhs.setLinkTimeout(rhs.getTimeSpecification(), rhs.getTimeoutFlags());
 
-    return rhs;
+    return lhs;
 }
 
 auto coContext::internal::operator|(AsyncWaiter asyncWaiter, const Marker &marker) -> AsyncWaiter {
-    asyncWaiter.getSubmission().addFlags(marker.getFlags());
-    marker.executeAction();
+    std::uint32_t flags{marker.getFlags()};
+
+    // the link of a timeout marker is the one to its own timeout, expiring at the earlier of it and a scope's deadline
+    if (marker.hasLinkTimeout()) {
+        asyncWaiter.setLinkTimeout(marker.getTimeSpecification(), marker.getTimeoutFlags());
+        flags &= ~IOSQE_IO_LINK;
+    }
+    asyncWaiter.addFlags(flags);
 
     return asyncWaiter;
 }
@@ -0,0 +1,96 @@
+#include "FrameAllocator.hpp"
+
+#include "../log/Exception.hpp"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+
+coContext::internal::FrameAllocator::~FrameAllocator() {
+    for (const std::span<std::byte> arena : this->arenas) munmap(std::data(arena), std::size(arena));
+}
+
+auto coContext::internal::FrameAllocator::allocate(const std::size_t bytes) -> void * {
+    if (bytes > maxSize) return getUnsyncMemoryResource()->allocate(bytes);
+
+    const std::size_t sizeClass{getSizeClass(bytes)}, size{minSize << sizeClass};
+
+    void *pointer;
+    if (Node *const node{this->freeLists[sizeClass]}; node != nullptr) {
+        this->freeLists[sizeClass] = node->next;
+        pointer = node;
+    } else pointer = this->allocateFromArena(size);
+
+    ++this->statistics.liveFrames;
+    this->statistics.liveBytes += size;
+    this->statistics.peakLiveFrames = std::max(this->statistics.peakLiveFrames, this->statistics.liveFrames);
+    this->statistics.peakLiveBytes = std::max(this->statistics.peakLiveBytes, this->statistics.liveBytes);
+
+    return pointer;
+}
+
+auto coContext::internal::FrameAllocator::deallocate(void *const pointer, const std::size_t bytes) noexcept -> void {
+    if (bytes > maxSize) {
+        getUnsyncMemoryResource()->deallocate(pointer, bytes);
+
+        return;
+    }
+
+    const std::size_t sizeClass{getSizeClass(bytes)};
+
+    Node *const node{static_cast<Node *>(pointer)};
+    node->next = this->freeLists[sizeClass];
+    this->freeLists[sizeClass] = node;
+
+    --this->statistics.liveFrames;
+    this->statistics.liveBytes -= minSize << sizeClass;
+}
+
+auto coContext::internal::FrameAllocator::getStatistics() const noexcept -> frame::Statistics { return this->statistics; }
+
+auto coContext::internal::FrameAllocator::enableHugePage() noexcept -> void { this->isHugePage = true; }
+
+auto coContext::internal::FrameAllocator::disableHugePage() noexcept -> void { this->isHugePage = false; }
+
+auto coContext::internal::FrameAllocator::getSizeClass(const std::size_t bytes) noexcept -> std::size_t {
+    return static_cast<std::size_t>(std::countr_zero(std::bit_ceil(std::max(bytes, minSize))) -
+                                    std::countr_zero(minSize));
+}
+
+auto coContext::internal::FrameAllocator::allocateFromArena(const std::size_t bytes) -> void * {
+    if (this->cursor == nullptr || static_cast<std::size_t>(this->end - this->cursor) < bytes) this->allocateArena();
+
+    void *const pointer{this->cursor};
+    this->cursor += bytes;
+
+    return pointer;
+}
+
+auto coContext::internal::FrameAllocator::allocateArena(const std::source_location sourceLocation) -> void {
+    void *pointer{MAP_FAILED};
+    if (this->isHugePage) {
+        pointer = mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    if (pointer == MAP_FAILED) {
+        pointer = mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pointer == MAP_FAILED) {
+            throw Exception{
+                Log{Log::Level::fatal,
+                    std::pmr::string{std::error_code{errno, std::generic_category()}.message(),
+                                     getSyncMemoryResource()},
+                    sourceLocation}
+            };
+        }
+    }
+
+    this->arenas.emplace_back(static_cast<std::byte *>(pointer), arenaSize);
+    this->cursor = static_cast<std::byte *>(pointer);
+    this->end = this->cursor + arenaSize;
+    this->statistics.reservedBytes += arenaSize;
+}
+
+auto coContext::internal::getFrameAllocator() -> FrameAllocator & {
+    thread_local FrameAllocator allocator;
+
+    return allocator;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "coContext/memory/frame.hpp"
+#include "coContext/memory/memoryResource.hpp"
+
+#include <array>
+#include <bit>
+#include <source_location>
+#include <span>
+#include <vector>
+
+namespace coContext::internal {
+    // frames are carved from 2 MiB arenas and recycled through per-size-class free lists; the arenas are only returned
+    // to the system when the thread exits, so the reserved size follows the peak number of live frames
+    class FrameAllocator {
+        struct Node {
+            Node *next;
+        };
+
+    public:
+        FrameAllocator() = default;
+
+        FrameAllocator(const FrameAllocator &) = delete;
+
+        auto operator=(const FrameAllocator &) -> FrameAllocator & = delete;
+
+        FrameAllocator(FrameAllocator &&) noexcept = delete;
+
+        auto operator=(FrameAllocator &&) noexcept -> FrameAllocator & = delete;
+
+        ~FrameAllocator();
+
+        [[nodiscard]] auto allocate(std::size_t bytes) -> void *;
+
+        auto deallocate(void *pointer, std::size_t bytes) noexcept -> void;
+
+        [[nodiscard]] auto getStatistics() const noexcept -> frame::Statistics;
+
+        auto enableHugePage() noexcept -> void;
+
+        auto disableHugePage() noexcept -> void;
+
+    private:
+        [[nodiscard]] static auto getSizeClass(std::size_t bytes) noexcept -> std::size_t;
+
+        [[nodiscard]] auto allocateFromArena(std::size_t bytes) -> void *;
+
+        auto allocateArena(std::source_location sourceLocation = std::source_location::current()) -> void;
+
+        static constexpr std::size_t minSize{64}, maxSize{16384}, arenaSize{2 * 1024 * 1024};
+        static constexpr std::size_t sizeClassCount{std::countr_zero(maxSize) - std::countr_zero(minSize) + 1};
+
+        std::array<Node *, sizeClassCount> freeLists{};
+        std::pmr::vector<std::span<std::byte>> arenas{getUnsyncMemoryResource()};
+        std::byte *cursor{}, *end{};
+        frame::Statistics statistics{};
+        bool isHugePage{};
+    };
+
+    [[nodiscard]] auto getFrameAllocator() -> FrameAllocator &;
+}    // namespace coContext::internal
@@ -0,0 +1,9 @@
+#include "coContext/memory/frame.hpp"
+
+#include "FrameAllocator.hpp"
+
+auto coContext::frame::getStatistics() -> Statistics { return internal::getFrameAllocator().getStatistics(); }
+
+auto coContext::frame::enableHugePage() -> void { internal::getFrameAllocator().enableHugePage(); }
+
+auto coContext::frame::disableHugePage() -> void { internal::getFrameAllocator().disableHugePage(); }
@@ -12,6 +12,10 @@ namespace {
 }    // namespace
 #endif    // NDEBUG
 
+namespace {
+    thread_local constinit std::pmr::memory_resource *frameResource{};
+}    // namespace
+
 auto coContext::internal::getSyncMemoryResource() -> std::pmr::memory_resource * {
 #ifdef NDEBUG
     static std::pmr::synchronized_pool_resource resource{getUpstreamResource()};
@@ -31,3 +35,20 @@ auto coContext::internal::getUnsyncMemoryResource() -> std::pmr::memory_resource
 
     return std::addressof(resource);
 }
+
+auto coContext::internal::getFrameMemoryResource() -> std::pmr::memory_resource * {
+    return frameResource;
+}
+
+auto coContext::internal::setFrameMemoryResource(std::pmr::memory_resource *const resource) noexcept -> void {
+    frameResource = resource;
+}
+
+coContext::internal::FrameMemoryResourceScope::FrameMemoryResourceScope(
+    std::pmr::memory_resource *const resource) noexcept : previousResource{getFrameMemoryResource()} {
+    setFrameMemoryResource(resource);
+}
+
+coContext::internal::FrameMemoryResourceScope::~FrameMemoryResourceScope() {
+    setFrameMemoryResource(this->previousResource);
+}
@@ -0,0 +1,62 @@
+#include "coContext/ring/BufferLease.hpp"
+
+#include "BufferRing.hpp"
+
+#include <utility>
+
+coContext::BufferLease::BufferLease(internal::BufferRing *const bufferRing, const std::uint16_t bufferId,
+                                    const std::span<const std::byte> data) noexcept :
+    bufferRing{bufferRing}, bufferId{bufferId}, data{data} {
+    if (this->bufferRing != nullptr) this->bufferRing->acquireBuffer(this->bufferId);
+}
+
+coContext::BufferLease::BufferLease(const BufferLease &other) noexcept :
+    BufferLease{other.bufferRing, other.bufferId, other.data} {}
+
+auto coContext::BufferLease::operator=(const BufferLease &other) noexcept -> BufferLease & {
+    if (this == std::addressof(other)) return *this;
+
+    this->~BufferLease();
+
+    this->bufferRing = other.bufferRing;
+    this->bufferId = other.bufferId;
+    this->data = other.data;
+    if (this->bufferRing != nullptr) this->bufferRing->acquireBuffer(this->bufferId);
+
+    return *this;
+}
+
+coContext::BufferLease::BufferLease(BufferLease &&other) noexcept :
+    bufferRing{std::exchange(other.bufferRing, nullptr)}, bufferId{other.bufferId},
+    data{std::exchange(other.data, {})} {}
+
+auto coContext::BufferLease::operator=(BufferLease &&other) noexcept -> BufferLease & {
+    if (this == std::addressof(other)) return *this;
+
+    this->~BufferLease();
+
+    this->bufferRing = std::exchange(other.bufferRing, nullptr);
+    this->bufferId = other.bufferId;
+    this->data = std::exchange(other.data, {});
+
+    return *this;
+}
+
+coContext::BufferLease::~BufferLease() {
+    if (this->bufferRing != nullptr) this->bufferRing->releaseBuffer(this->bufferId);
+}
+
+auto coContext::BufferLease::swap(BufferLease &other) noexcept -> void {
+    std::swap(this->bufferRing, other.bufferRing);
+    std::swap(this->bufferId, other.bufferId);
+    std::swap(this->data, other.data);
+}
+
+auto coContext::BufferLease::getData() const noexcept -> std::span<const std::byte> { return this->data; }
+
+auto coContext::BufferLease::reset() noexcept -> void {
+    this->~BufferLease();
+
+    this->bufferRing = nullptr;
+    this->data = {};
+}
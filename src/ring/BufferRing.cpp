@@ -2,80 +2,236 @@
 
 #include "../log/Exception.hpp"
 #include "Ring.hpp"
+#include "coContext/log/logger.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
 
 using namespace std::string_view_literals;
 
 coContext::internal::BufferRing::BufferRing(std::shared_ptr<Ring> ring, const std::uint32_t entries,
-                                            const std::int32_t id, const std::uint32_t flags) :
-    ring{std::move(ring)}, handle{this->ring->setupBufferRing(entries, id, flags)}, entries{entries}, id{id} {}
+                                            const std::int32_t id, const std::uint32_t flags,
+                                            const std::size_t bufferSize, const BufferPolicy policy,
+                                            const bool isHugePage) :
+    ring{std::move(ring)}, isHugePage{isHugePage}, slab{mapSlab(entries * bufferSize, this->isHugePage)},
+    handle{this->ring->setupBufferRing(entries, id, flags)}, entries{entries}, id{id}, bufferSize{bufferSize},
+    policy{policy} {
+    this->queue.resize(entries);
+
+    this->policy.highWatermark = std::clamp(this->policy.highWatermark, 1U, entries);
+    this->policy.lowWatermark = std::min(this->policy.lowWatermark, this->policy.highWatermark);
+
+    this->resize(this->policy.lowWatermark);
+    this->advance();
+}
 
 coContext::internal::BufferRing::BufferRing(BufferRing &&other) noexcept :
-    buffers{std::move(other.buffers)}, ring{std::move(other.ring)}, handle{std::exchange(other.handle, nullptr)},
-    entries{other.entries}, id{other.id}, offset{other.offset} {}
+    ring{std::move(other.ring)}, isHugePage{other.isHugePage}, slab{std::exchange(other.slab, {})},
+    handle{std::exchange(other.handle, nullptr)}, buffers{std::move(other.buffers)}, queue{std::move(other.queue)},
+    entries{other.entries},
+    queueHead{other.queueHead}, queueTail{other.queueTail}, id{other.id}, offset{other.offset},
+    bufferSize{other.bufferSize}, policy{other.policy}, statistics{other.statistics},
+    lastNoBufferTime{other.lastNoBufferTime} {}
 
 auto coContext::internal::BufferRing::operator=(BufferRing &&other) noexcept -> BufferRing & {
     if (this == std::addressof(other)) return *this;
 
     this->~BufferRing();
 
-    this->buffers = std::move(other.buffers);
     this->ring = std::move(other.ring);
+    this->isHugePage = other.isHugePage;
+    this->slab = std::exchange(other.slab, {});
     this->handle = std::exchange(other.handle, nullptr);
+    this->buffers = std::move(other.buffers);
+    this->queue = std::move(other.queue);
     this->entries = other.entries;
+    this->queueHead = other.queueHead;
+    this->queueTail = other.queueTail;
     this->id = other.id;
     this->offset = other.offset;
+    this->bufferSize = other.bufferSize;
+    this->policy = other.policy;
+    this->statistics = other.statistics;
+    this->lastNoBufferTime = other.lastNoBufferTime;
 
     return *this;
 }
 
 coContext::internal::BufferRing::~BufferRing() {
     if (this->handle != nullptr) this->ring->freeBufferRing(this->handle, this->entries, this->id);
+    if (!std::empty(this->slab)) munmap(std::data(this->slab), std::size(this->slab));
 }
 
 auto coContext::internal::BufferRing::swap(BufferRing &other) noexcept -> void {
-    std::swap(this->buffers, other.buffers);
     std::swap(this->ring, other.ring);
+    std::swap(this->isHugePage, other.isHugePage);
+    std::swap(this->slab, other.slab);
     std::swap(this->handle, other.handle);
+    std::swap(this->buffers, other.buffers);
+    std::swap(this->queue, other.queue);
     std::swap(this->entries, other.entries);
+    std::swap(this->queueHead, other.queueHead);
+    std::swap(this->queueTail, other.queueTail);
     std::swap(this->id, other.id);
     std::swap(this->offset, other.offset);
+    std::swap(this->bufferSize, other.bufferSize);
+    std::swap(this->policy, other.policy);
+    std::swap(this->statistics, other.statistics);
+    std::swap(this->lastNoBufferTime, other.lastNoBufferTime);
 }
 
 auto coContext::internal::BufferRing::getId() const noexcept -> std::int32_t { return this->id; }
 
-auto coContext::internal::BufferRing::advance(const std::int32_t count) noexcept -> void {
-    this->ring->advance(this->handle, count, std::exchange(this->offset, 0));
+auto coContext::internal::BufferRing::getBufferSize() const noexcept -> std::size_t { return this->bufferSize; }
+
+auto coContext::internal::BufferRing::getStatistics() const noexcept -> BufferStatistics { return this->statistics; }
+
+auto coContext::internal::BufferRing::advance() noexcept -> void {
+    io_uring_buf_ring_advance(this->handle, std::exchange(this->offset, 0));
 }
 
 auto coContext::internal::BufferRing::readData(const std::uint16_t bufferId, const std::size_t dataSize) noexcept
     -> std::span<const std::byte> {
-    this->addBuffer(bufferId);
-
-    auto &[data, offset]{this->buffers[bufferId]};
-    const std::span subData{std::cbegin(data) + static_cast<std::ptrdiff_t>(offset), dataSize};
-    offset += dataSize;
+    std::uint32_t &offset{this->buffers[bufferId].offset};
+    const std::span<const std::byte> subData{this->slab.subspan(bufferId * this->bufferSize + offset, dataSize)};
+    offset += static_cast<std::uint32_t>(dataSize);
 
     return subData;
 }
 
-auto coContext::internal::BufferRing::markBufferUsed(const std::uint16_t bufferId) noexcept -> void {
-    this->buffers[bufferId].offset = 0;
+auto coContext::internal::BufferRing::readBundle(const std::uint16_t bufferId, std::size_t dataSize)
+    -> std::pmr::vector<BufferLease> {
+    std::pmr::vector<BufferLease> leases{getUnsyncMemoryResource()};
+
+    for (std::uint16_t id{bufferId};; id = this->queue[this->queueHead & io_uring_buf_ring_mask(this->entries)]) {
+        const std::size_t size{std::min<std::size_t>(dataSize, this->bufferSize - this->buffers[id].offset)};
+        leases.emplace_back(this, id, this->readData(id, size));
+        dataSize -= size;
+
+        if (this->buffers[id].offset == this->bufferSize) this->finishBuffer(id);
+        if (dataSize == 0) break;
+    }
+
+    return leases;
+}
+
+auto coContext::internal::BufferRing::acquireBuffer(const std::uint16_t bufferId) noexcept -> void {
+    ++this->buffers[bufferId].leaseCount;
+}
+
+auto coContext::internal::BufferRing::releaseBuffer(const std::uint16_t bufferId) noexcept -> void {
+    if (Buffer &buffer{this->buffers[bufferId]}; --buffer.leaseCount == 0 && !buffer.isQueued)
+        this->recycleBuffer(bufferId);
+}
+
+auto coContext::internal::BufferRing::finishBuffer(const std::uint16_t bufferId) noexcept -> void {
+    ++this->queueHead;
+
+    Buffer &buffer{this->buffers[bufferId]};
+    buffer.isQueued = false;
+
+    if (buffer.leaseCount == 0) this->recycleBuffer(bufferId);
+}
+
+auto coContext::internal::BufferRing::handleNoBuffer(const std::source_location sourceLocation) -> bool {
+    ++this->statistics.noBufferCount;
+    this->lastNoBufferTime = coContext::now();
+
+    if (this->statistics.bufferCount == this->policy.highWatermark) {
+        logger::write(Log{
+            Log::Level::warn, std::pmr::string{"number of buffer has reached the limit"sv, getSyncMemoryResource()},
+            sourceLocation
+        });
+
+        return false;
+    }
+
+    logger::write(Log{
+        Log::Level::warn, std::pmr::string{"no buffer, growing the buffer group"sv, getSyncMemoryResource()},
+        sourceLocation
+    });
+
+    this->resize(std::min(std::max(this->statistics.bufferCount * 2, 1U), this->policy.highWatermark));
+    ++this->statistics.growCount;
+
+    return true;
+}
+
+auto coContext::internal::BufferRing::shrink(const std::chrono::steady_clock::time_point now) noexcept -> void {
+    if (this->statistics.bufferCount <= this->policy.lowWatermark ||
+        now - this->lastNoBufferTime < this->policy.idleTime)
+        return;
+
+    this->statistics.bufferCount = std::max(this->statistics.bufferCount / 2, this->policy.lowWatermark);
+    ++this->statistics.shrinkCount;
+    this->lastNoBufferTime = now;
+}
+
+auto coContext::internal::BufferRing::mapSlab(const std::size_t size, bool &isHugePage,
+                                              const std::source_location sourceLocation) -> std::span<std::byte> {
+    void *pointer{MAP_FAILED};
+    if (isHugePage) {
+        pointer = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_HUGETLB, -1, 0);
+    }
+    if (pointer == MAP_FAILED) {
+        isHugePage = false;
+        pointer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (pointer == MAP_FAILED) {
+            throw Exception{
+                Log{Log::Level::fatal,
+                    std::pmr::string{std::error_code{errno, std::generic_category()}.message(),
+                                     getSyncMemoryResource()},
+                    sourceLocation}
+            };
+        }
+    }
+
+    return std::span{static_cast<std::byte *>(pointer), size};
 }
 
-auto coContext::internal::BufferRing::expandBuffer(const std::source_location sourceLocation) -> void {
-    if (std::size(this->buffers) == this->entries) {
-        throw Exception{
-            Log{Log::Level::warn, std::pmr::string{"number of buffer has reached the limit"sv, getSyncMemoryResource()},
-                sourceLocation}
-        };
+auto coContext::internal::BufferRing::resize(const std::uint32_t count) -> void {
+    if (std::size(this->buffers) < count) this->buffers.resize(count);
+
+    for (std::uint32_t i{this->statistics.bufferCount}; i < count; ++i) {
+        if (const Buffer &buffer{this->buffers[i]}; !buffer.isQueued && buffer.leaseCount == 0) this->addBuffer(i);
     }
 
-    this->buffers.emplace_back();
-    this->addBuffer(std::size(this->buffers) - 1);
+    this->statistics.bufferCount = count;
+}
+
+auto coContext::internal::BufferRing::recycleBuffer(const std::uint16_t bufferId) noexcept -> void {
+    this->buffers[bufferId].offset = 0;
+
+    if (bufferId < this->statistics.bufferCount) this->addBuffer(bufferId);
+    else this->releasePages(bufferId);
 }
 
 auto coContext::internal::BufferRing::addBuffer(const std::uint16_t bufferId) noexcept -> void {
-    const std::span data{this->buffers[bufferId].data};
-    io_uring_buf_ring_add(this->handle, std::data(data), std::size(data), bufferId,
-                          io_uring_buf_ring_mask(this->entries), this->offset++);
+    this->buffers[bufferId].isQueued = true;
+    this->queue[this->queueTail++ & io_uring_buf_ring_mask(this->entries)] = bufferId;
+
+    io_uring_buf_ring_add(this->handle, std::data(this->slab) + bufferId * this->bufferSize, this->bufferSize,
+                          bufferId, io_uring_buf_ring_mask(this->entries), this->offset++);
+}
+
+// a page is only given back once no buffer on it is in use, a small buffer shares its page with its neighbours which
+// may still be leased or queued; hugetlb pages cannot be released one buffer at a time
+auto coContext::internal::BufferRing::releasePages(const std::uint16_t bufferId) noexcept -> void {
+    if (this->isHugePage) return;
+
+    static const auto pageSize{static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+    const std::size_t end{std::min(std::size(this->slab), (bufferId + 1) * this->bufferSize)};
+    for (std::size_t page{bufferId * this->bufferSize / pageSize * pageSize}; page < end; page += pageSize) {
+        const std::size_t first{page / this->bufferSize};
+        if (first < this->statistics.bufferCount) continue;
+
+        const std::size_t last{std::min((page + pageSize - 1) / this->bufferSize + 1, std::size(this->buffers))};
+        if (std::ranges::all_of(std::span{this->buffers}.subspan(first, last - first), [](const Buffer &buffer) {
+                return !buffer.isQueued && buffer.leaseCount == 0;
+            }))
+            static_cast<void>(madvise(std::data(this->slab) + page, pageSize, MADV_DONTNEED));
+    }
 }
@@ -1,22 +1,28 @@
 #pragma once
 
+#include "coContext/context/Clock.hpp"
 #include "coContext/memory/memoryResource.hpp"
+#include "coContext/ring/BufferLease.hpp"
+#include "coContext/ring/BufferPolicy.hpp"
 
 #include <liburing/io_uring.h>
 #include <memory>
 #include <source_location>
+#include <span>
+#include <vector>
 
 namespace coContext::internal {
     class Ring;
 
     class BufferRing {
         struct Buffer {
-            std::pmr::vector<std::byte> data{1024, getUnsyncMemoryResource()};
-            std::size_t offset{};
+            std::uint32_t offset, leaseCount;
+            bool isQueued;
         };
 
     public:
-        BufferRing(std::shared_ptr<Ring> ring, std::uint32_t entries, std::int32_t id, std::uint32_t flags);
+        BufferRing(std::shared_ptr<Ring> ring, std::uint32_t entries, std::int32_t id, std::uint32_t flags,
+                   std::size_t bufferSize, BufferPolicy policy, bool isHugePage);
 
         BufferRing(const BufferRing &) = delete;
 
@@ -32,23 +38,56 @@ namespace coContext::internal {
 
         [[nodiscard]] auto getId() const noexcept -> std::int32_t;
 
-        auto advance(std::int32_t count) noexcept -> void;
+        [[nodiscard]] auto getBufferSize() const noexcept -> std::size_t;
+
+        [[nodiscard]] auto getStatistics() const noexcept -> BufferStatistics;
+
+        auto advance() noexcept -> void;
 
         [[nodiscard]] auto readData(std::uint16_t bufferId, std::size_t dataSize) noexcept
             -> std::span<const std::byte>;
 
-        auto markBufferUsed(std::uint16_t bufferId) noexcept -> void;
+        [[nodiscard]] auto readBundle(std::uint16_t bufferId, std::size_t dataSize) -> std::pmr::vector<BufferLease>;
+
+        auto acquireBuffer(std::uint16_t bufferId) noexcept -> void;
+
+        auto releaseBuffer(std::uint16_t bufferId) noexcept -> void;
+
+        auto finishBuffer(std::uint16_t bufferId) noexcept -> void;
+
+        // the -ENOBUFS handling shared by every multishot request on this group, it logs and grows the group up to its
+        // high watermark; false once the group is at it, a restarted request would only run out of buffers again
+        [[nodiscard]] auto handleNoBuffer(std::source_location sourceLocation = std::source_location::current())
+            -> bool;
 
-        auto expandBuffer(std::source_location sourceLocation = std::source_location::current()) -> void;
+        auto shrink(std::chrono::steady_clock::time_point now) noexcept -> void;
 
     private:
+        // falls back to regular pages and clears isHugePage when no huge page is available
+        [[nodiscard]] static auto mapSlab(std::size_t size, bool &isHugePage,
+                                          std::source_location sourceLocation = std::source_location::current())
+            -> std::span<std::byte>;
+
+        auto resize(std::uint32_t count) -> void;
+
+        auto recycleBuffer(std::uint16_t bufferId) noexcept -> void;
+
         auto addBuffer(std::uint16_t bufferId) noexcept -> void;
 
-        std::pmr::vector<Buffer> buffers{getUnsyncMemoryResource()};
+        auto releasePages(std::uint16_t bufferId) noexcept -> void;
+
         std::shared_ptr<Ring> ring;
+        bool isHugePage;
+        std::span<std::byte> slab;
         io_uring_buf_ring *handle;
-        std::uint32_t entries;
+        std::pmr::vector<Buffer> buffers{getUnsyncMemoryResource()};
+        std::pmr::vector<std::uint16_t> queue{getUnsyncMemoryResource()};
+        std::uint32_t entries, queueHead{}, queueTail{};
         std::int32_t id, offset{};
+        std::size_t bufferSize;
+        BufferPolicy policy;
+        BufferStatistics statistics{};
+        std::chrono::steady_clock::time_point lastNoBufferTime{coContext::now()};
     };
 }    // namespace coContext::internal
 
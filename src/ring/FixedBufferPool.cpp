@@ -0,0 +1,130 @@
+#include "FixedBufferPool.hpp"
+
+#include "../log/Exception.hpp"
+#include "Ring.hpp"
+#include "coContext/log/logger.hpp"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <format>
+
+using namespace std::string_view_literals;
+
+coContext::internal::FixedBufferPool::FixedBufferPool(std::shared_ptr<Ring> ring, const std::uint32_t count,
+                                                      const std::size_t size) :
+    ring{std::move(ring)}, size{size} {
+    if (count == 0 || size == 0) return;
+
+    this->slab = mapSlab(count * size);
+
+    try {
+        this->registerSlab();
+    } catch (Exception &exception) {
+        // pinning is charged against RLIMIT_MEMLOCK, a context without fixed buffers is still usable
+        logger::write(Log{std::move(exception.getLog())});
+
+        munmap(std::data(this->slab), std::size(this->slab));
+        this->slab = {};
+
+        return;
+    }
+
+    this->isAllocated.resize(count);
+    this->freeIndexes.resize(count);
+    std::ranges::generate(this->freeIndexes, [index = count]() mutable { return --index; });
+}
+
+coContext::internal::FixedBufferPool::FixedBufferPool(FixedBufferPool &&other) noexcept :
+    ring{std::move(other.ring)}, slab{std::exchange(other.slab, {})}, freeIndexes{std::move(other.freeIndexes)},
+    isAllocated{std::move(other.isAllocated)}, size{other.size} {}
+
+auto coContext::internal::FixedBufferPool::operator=(FixedBufferPool &&other) noexcept -> FixedBufferPool & {
+    if (this == std::addressof(other)) return *this;
+
+    this->~FixedBufferPool();
+
+    this->ring = std::move(other.ring);
+    this->slab = std::exchange(other.slab, {});
+    this->freeIndexes = std::move(other.freeIndexes);
+    this->isAllocated = std::move(other.isAllocated);
+    this->size = other.size;
+
+    return *this;
+}
+
+coContext::internal::FixedBufferPool::~FixedBufferPool() {
+    if (!std::empty(this->slab)) munmap(std::data(this->slab), std::size(this->slab));
+}
+
+auto coContext::internal::FixedBufferPool::swap(FixedBufferPool &other) noexcept -> void {
+    std::swap(this->ring, other.ring);
+    std::swap(this->slab, other.slab);
+    std::swap(this->freeIndexes, other.freeIndexes);
+    std::swap(this->isAllocated, other.isAllocated);
+    std::swap(this->size, other.size);
+}
+
+auto coContext::internal::FixedBufferPool::allocate(const std::size_t size, const std::source_location sourceLocation)
+    -> FixedBuffer {
+    if (size > this->size) {
+        throw Exception{
+            Log{Log::Level::error,
+                std::pmr::string{std::format("fixed buffer size {} exceeds the slot size {}", size, this->size),
+                                 getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    if (std::empty(this->freeIndexes)) {
+        throw Exception{
+            Log{Log::Level::error, std::pmr::string{"fixed buffer pool is exhausted"sv, getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    const std::uint32_t index{this->freeIndexes.back()};
+    this->freeIndexes.pop_back();
+    this->isAllocated[index] = true;
+
+    return FixedBuffer{this->slab.subspan(index * this->size, size), index};
+}
+
+auto coContext::internal::FixedBufferPool::release(const FixedBuffer buffer, const std::source_location sourceLocation)
+    -> void {
+    if (buffer.index >= std::size(this->isAllocated) || !this->isAllocated[buffer.index] ||
+        std::data(buffer.data) != std::data(this->slab) + buffer.index * this->size) {
+        throw Exception{
+            Log{Log::Level::error,
+                std::pmr::string{std::format("fixed buffer {} is not allocated from this pool", buffer.index),
+                                 getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    this->isAllocated[buffer.index] = false;
+    this->freeIndexes.emplace_back(buffer.index);
+}
+
+auto coContext::internal::FixedBufferPool::mapSlab(const std::size_t size, const std::source_location sourceLocation)
+    -> std::span<std::byte> {
+    void *const pointer{mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+    if (pointer == MAP_FAILED) {
+        throw Exception{
+            Log{Log::Level::fatal,
+                std::pmr::string{std::error_code{errno, std::generic_category()}.message(), getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+
+    return std::span{static_cast<std::byte *>(pointer), size};
+}
+
+auto coContext::internal::FixedBufferPool::registerSlab() -> void {
+    std::pmr::vector<iovec> buffers{getUnsyncMemoryResource()};
+    buffers.reserve(std::size(this->slab) / this->size);
+    for (std::size_t offset{}; offset != std::size(this->slab); offset += this->size)
+        buffers.emplace_back(std::data(this->slab) + offset, this->size);
+
+    this->ring->registerBuffer(buffers);
+}
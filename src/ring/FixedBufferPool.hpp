@@ -0,0 +1,58 @@
+#pragma once
+
+#include "coContext/memory/memoryResource.hpp"
+#include "coContext/ring/FixedBuffer.hpp"
+
+#include <memory>
+#include <source_location>
+#include <span>
+#include <vector>
+
+namespace coContext::internal {
+    class Ring;
+
+    // count slots of size bytes carved from one slab that is registered once, allocate and release only move slot
+    // indexes through the free list and never enter the kernel
+    class FixedBufferPool {
+    public:
+        FixedBufferPool(std::shared_ptr<Ring> ring, std::uint32_t count, std::size_t size);
+
+        FixedBufferPool(const FixedBufferPool &) = delete;
+
+        auto operator=(const FixedBufferPool &) -> FixedBufferPool & = delete;
+
+        FixedBufferPool(FixedBufferPool &&) noexcept;
+
+        auto operator=(FixedBufferPool &&) noexcept -> FixedBufferPool &;
+
+        ~FixedBufferPool();
+
+        auto swap(FixedBufferPool &other) noexcept -> void;
+
+        [[nodiscard]] auto allocate(std::size_t size,
+                                    std::source_location sourceLocation = std::source_location::current())
+            -> FixedBuffer;
+
+        auto release(FixedBuffer buffer, std::source_location sourceLocation = std::source_location::current())
+            -> void;
+
+    private:
+        [[nodiscard]] static auto mapSlab(std::size_t size,
+                                          std::source_location sourceLocation = std::source_location::current())
+            -> std::span<std::byte>;
+
+        auto registerSlab() -> void;
+
+        std::shared_ptr<Ring> ring;
+        std::span<std::byte> slab;
+        std::pmr::vector<std::uint32_t> freeIndexes{getUnsyncMemoryResource()};
+        std::pmr::vector<bool> isAllocated{getUnsyncMemoryResource()};
+        std::size_t size;
+    };
+}    // namespace coContext::internal
+
+template<>
+constexpr auto std::swap(coContext::internal::FixedBufferPool &lhs,
+                         coContext::internal::FixedBufferPool &rhs) noexcept -> void {
+    lhs.swap(rhs);
+}
@@ -1,7 +1,6 @@
 #include "Ring.hpp"
 
 #include "../log/Exception.hpp"
-#include "Completion.hpp"
 
 using namespace std::string_view_literals;
 
@@ -41,6 +40,8 @@ coContext::internal::Ring::~Ring() {
 
 auto coContext::internal::Ring::swap(Ring &other) noexcept -> void { std::swap(this->handle, other.handle); }
 
+auto coContext::internal::Ring::getFileDescriptor() const noexcept -> std::int32_t { return this->handle.ring_fd; }
+
 auto coContext::internal::Ring::registerSelfFileDescriptor(const std::source_location sourceLocation) -> void {
     if (const std::int32_t result{io_uring_register_ring_fd(std::addressof(this->handle))}; result != 1) {
         throw Exception{
@@ -64,6 +65,20 @@ auto coContext::internal::Ring::registerSparseFileDescriptor(const std::uint32_t
     }
 }
 
+auto coContext::internal::Ring::registerBuffer(const std::span<const iovec> buffers,
+                                               const std::source_location sourceLocation) -> void {
+    if (const std::int32_t result{io_uring_register_buffers(std::addressof(this->handle), std::data(buffers),
+                                                            static_cast<std::uint32_t>(std::size(buffers)))};
+        result != 0) {
+        throw Exception{
+            Log{Log::Level::error,
+                std::pmr::string{std::error_code{std::abs(result), std::generic_category()}.message(),
+                                 getSyncMemoryResource()},
+                sourceLocation}
+        };
+    }
+}
+
 auto coContext::internal::Ring::setupBufferRing(const std::uint32_t entries, const std::int32_t id,
                                                 const std::uint32_t flags, const std::source_location sourceLocation)
     -> io_uring_buf_ring * {
@@ -131,22 +146,13 @@ auto coContext::internal::Ring::submitAndWait(const std::uint32_t count, const s
     }
 }
 
-auto coContext::internal::Ring::poll(std::move_only_function<auto(Completion)->void> action) const -> std::int32_t {
-    std::int32_t count{};
-
-    std::uint32_t head;
-    const io_uring_cqe *completion;
-    io_uring_for_each_cqe(std::addressof(this->handle), head, completion) {
-        action(Completion{completion});
-        ++count;
-    }
-
-    return count;
+auto coContext::internal::Ring::peek(const std::span<io_uring_cqe *> completions) noexcept -> std::uint32_t {
+    return io_uring_peek_batch_cqe(std::addressof(this->handle), std::data(completions),
+                                   static_cast<std::uint32_t>(std::size(completions)));
 }
 
-auto coContext::internal::Ring::advance(io_uring_buf_ring *const bufferRing, const std::int32_t completionCount,
-                                        const std::int32_t bufferCount) noexcept -> void {
-    __io_uring_buf_ring_cq_advance(std::addressof(this->handle), bufferRing, completionCount, bufferCount);
+auto coContext::internal::Ring::advance(const std::uint32_t count) noexcept -> void {
+    io_uring_cq_advance(std::addressof(this->handle), count);
 }
 
 auto coContext::internal::Ring::syncCancel(io_uring_sync_cancel_reg *const parameters,
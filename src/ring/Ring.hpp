@@ -1,12 +1,10 @@
 #pragma once
 
-#include <functional>
 #include <liburing.h>
 #include <source_location>
+#include <span>
 
 namespace coContext::internal {
-    class Completion;
-
     class Ring {
     public:
         Ring(std::uint32_t entries, io_uring_params *parameters);
@@ -23,12 +21,17 @@ namespace coContext::internal {
 
         auto swap(Ring &other) noexcept -> void;
 
+        [[nodiscard]] auto getFileDescriptor() const noexcept -> std::int32_t;
+
         auto registerSelfFileDescriptor(std::source_location sourceLocation = std::source_location::current()) -> void;
 
         auto registerSparseFileDescriptor(std::uint32_t count,
                                           std::source_location sourceLocation = std::source_location::current())
             -> void;
 
+        auto registerBuffer(std::span<const iovec> buffers,
+                            std::source_location sourceLocation = std::source_location::current()) -> void;
+
         [[nodiscard]] auto setupBufferRing(std::uint32_t entries, std::int32_t id, std::uint32_t flags,
                                            std::source_location sourceLocation = std::source_location::current())
             -> io_uring_buf_ring *;
@@ -44,10 +47,9 @@ namespace coContext::internal {
         auto submitAndWait(std::uint32_t count, std::source_location sourceLocation = std::source_location::current())
             -> void;
 
-        [[nodiscard]] auto poll(std::move_only_function<auto(Completion)->void> action) const -> std::int32_t;
+        [[nodiscard]] auto peek(std::span<io_uring_cqe *> completions) noexcept -> std::uint32_t;
 
-        auto advance(io_uring_buf_ring *bufferRing, std::int32_t completionCount, std::int32_t bufferCount) noexcept
-            -> void;
+        auto advance(std::uint32_t count) noexcept -> void;
 
         [[nodiscard]] auto syncCancel(io_uring_sync_cancel_reg *parameters,
                                       std::source_location sourceLocation = std::source_location::current())
@@ -0,0 +1,131 @@
+#include "coContext/ring/SendQueue.hpp"
+
+#include "../context/Context.hpp"
+#include "coContext/coContext.hpp"
+
+#include <algorithm>
+#include <cerrno>
+
+coContext::SendQueue::Waiter::Waiter(SendQueue &sendQueue, const std::span<const std::byte> data) noexcept :
+    sendQueue{sendQueue}, data{data} {}
+
+auto coContext::SendQueue::Waiter::await_ready() const noexcept -> bool {
+    return std::empty(this->data) && this->sendQueue.getPendingSize() == 0;
+}
+
+auto coContext::SendQueue::Waiter::await_suspend(const std::coroutine_handle<> genericCoroutineHandle) -> void {
+    this->coroutineHandle = internal::Coroutine::Handle::from_address(genericCoroutineHandle.address());
+
+    this->sendQueue.enqueue(this->data, this->coroutineHandle);
+}
+
+auto coContext::SendQueue::Waiter::await_resume() const noexcept -> std::int32_t {
+    return this->coroutineHandle ? this->coroutineHandle.promise().getResult() : 0;
+}
+
+coContext::SendQueue::SendQueue(const std::int32_t socketFileDescriptor, const std::int32_t flags,
+                                internal::Marker marker) :
+    state{std::allocate_shared<State>(std::pmr::polymorphic_allocator{internal::getUnsyncMemoryResource()})} {
+    this->state->socketFileDescriptor = socketFileDescriptor;
+    this->state->flags = flags;
+    this->state->marker = std::move(marker);
+}
+
+coContext::SendQueue::~SendQueue() {
+    if (!this->state->isFlushing) return;
+
+    // queued data may go with the queue, so the kernel must be done reading it before the destructor returns; the
+    // flush still resumes on its completion and fails the writes left through the state it shares
+    this->state->isClosed = true;
+    static_cast<void>(internal::getContext().syncCancel(this->state->flushId, 0, __kernel_timespec{-1, -1}));
+}
+
+auto coContext::SendQueue::send(const std::span<const std::byte> data) noexcept -> Waiter {
+    return Waiter{*this, data};
+}
+
+auto coContext::SendQueue::post(const std::span<const std::byte> data) -> void {
+    if (!std::empty(data)) this->enqueue(data, nullptr);
+}
+
+auto coContext::SendQueue::getPendingSize() const noexcept -> std::size_t { return getPendingSize(*this->state); }
+
+auto coContext::SendQueue::enqueue(const std::span<const std::byte> data,
+                                   const internal::Coroutine::Handle coroutineHandle) -> void {
+    this->state->writers.emplace_back(data, 0, coroutineHandle);
+    if (this->state->isFlushing) return;
+
+    // deferred to the next scheduling pass so that every writer resumed by the current completion batch joins it; kept
+    // on this context, whose ring the socket and the woken writers belong to
+    this->state->isFlushing = true;
+    this->state->flushId = internal::getContext().spawn(std::move(flush(this->state).getCoroutine()));
+}
+
+auto coContext::SendQueue::flush(const std::shared_ptr<State> state) -> Task<> {
+    while (true) {
+        completeWriters(*state, 0);
+        if (getPendingSize(*state) == 0) break;
+
+        if (state->isClosed) {
+            failWriters(*state, -ECANCELED);
+
+            break;
+        }
+
+        state->vectors.clear();
+        for (std::size_t i{state->head}; i != std::size(state->writers) && std::size(state->vectors) != maxVectorCount;
+             ++i) {
+            const Writer &writer{state->writers[i]};
+            if (const std::span data{writer.data.subspan(writer.sentSize)}; !std::empty(data))
+                state->vectors.emplace_back(const_cast<std::byte *>(std::data(data)), std::size(data));
+        }
+
+        msghdr message{};
+        message.msg_iov = std::data(state->vectors);
+        message.msg_iovlen = std::size(state->vectors);
+
+        const std::int32_t result{
+            co_await (coContext::send(state->socketFileDescriptor, std::addressof(message), state->flags) |
+                      state->marker)};
+        // a stream socket only accepts nothing when the peer is gone, reporting 0 would read as a completed write
+        if (result <= 0) failWriters(*state, result == 0 ? -EPIPE : result);
+        else completeWriters(*state, static_cast<std::size_t>(result));
+    }
+
+    state->writers.clear();
+    state->head = 0;
+    state->isFlushing = false;
+}
+
+auto coContext::SendQueue::getPendingSize(const State &state) noexcept -> std::size_t {
+    return std::size(state.writers) - state.head;
+}
+
+auto coContext::SendQueue::completeWriters(State &state, std::size_t size) -> void {
+    for (; state.head != std::size(state.writers); ++state.head) {
+        Writer &writer{state.writers[state.head]};
+
+        const std::size_t sentSize{std::min(size, std::size(writer.data) - writer.sentSize)};
+        writer.sentSize += sentSize;
+        size -= sentSize;
+        if (writer.sentSize != std::size(writer.data)) break;
+
+        wake(writer, static_cast<std::int32_t>(std::size(writer.data)));
+    }
+}
+
+auto coContext::SendQueue::failWriters(State &state, const std::int32_t result) -> void {
+    if (result < 0) {
+        logger::write(Log{
+            Log::Level::warn,
+            std::pmr::string{std::error_code{std::abs(result), std::generic_category()}.message(),
+                             internal::getSyncMemoryResource()}
+        });
+    }
+
+    for (; state.head != std::size(state.writers); ++state.head) wake(state.writers[state.head], result);
+}
+
+auto coContext::SendQueue::wake(const Writer &writer, const std::int32_t result) -> void {
+    if (writer.coroutineHandle) internal::getContext().wake(writer.coroutineHandle, result);
+}
@@ -14,6 +14,14 @@ auto coContext::internal::Submission::noOperation(io_uring_sqe *const handle) no
     return Submission{handle};
 }
 
+auto coContext::internal::Submission::messageRing(io_uring_sqe *const handle, const std::int32_t ringFileDescriptor,
+                                                  const std::uint32_t result, const std::uint64_t userData,
+                                                  const std::uint32_t completionFlags) noexcept -> Submission {
+    io_uring_prep_msg_ring_cqe_flags(handle, ringFileDescriptor, result, userData, 0, completionFlags);
+
+    return Submission{handle};
+}
+
 auto coContext::internal::Submission::cancel(io_uring_sqe *const handle, const std::uint64_t userData,
                                              const std::int32_t flags) noexcept -> Submission {
     io_uring_prep_cancel64(handle, userData, flags);
@@ -218,6 +226,14 @@ auto coContext::internal::Submission::multipleReceive(io_uring_sqe *const handle
     return Submission{handle};
 }
 
+auto coContext::internal::Submission::multipleReceive(io_uring_sqe *const handle,
+                                                      const std::int32_t socketFileDescriptor, msghdr *const message,
+                                                      const std::uint32_t flags) noexcept -> Submission {
+    io_uring_prep_recvmsg_multishot(handle, socketFileDescriptor, message, flags);
+
+    return Submission{handle};
+}
+
 auto coContext::internal::Submission::send(io_uring_sqe *const handle, const std::int32_t socketFileDescriptor,
                                            const std::span<const std::byte> buffer, const std::int32_t flags) noexcept
     -> Submission {
@@ -244,6 +260,16 @@ auto coContext::internal::Submission::send(io_uring_sqe *const handle, const std
     return Submission{handle};
 }
 
+auto coContext::internal::Submission::sendFixed(io_uring_sqe *const handle, const std::int32_t socketFileDescriptor,
+                                                const std::span<const std::byte> buffer, const std::int32_t flags,
+                                                const std::uint32_t bufferIndex) noexcept -> Submission {
+    io_uring_prep_send(handle, socketFileDescriptor, std::data(buffer), std::size(buffer), flags);
+    handle->ioprio |= IORING_RECVSEND_FIXED_BUF;
+    handle->buf_index = static_cast<std::uint16_t>(bufferIndex);
+
+    return Submission{handle};
+}
+
 auto coContext::internal::Submission::zeroCopySend(io_uring_sqe *const handle, const std::int32_t socketFileDescriptor,
                                                    const std::span<const std::byte> buffer, const std::int32_t flags,
                                                    const std::uint32_t zeroCopyFlags) noexcept -> Submission {
@@ -260,6 +286,17 @@ auto coContext::internal::Submission::zeroCopySend(io_uring_sqe *const handle, c
     return Submission{handle};
 }
 
+auto coContext::internal::Submission::zeroCopySendFixed(io_uring_sqe *const handle,
+                                                        const std::int32_t socketFileDescriptor,
+                                                        const std::span<const std::byte> buffer,
+                                                        const std::int32_t flags, const std::uint32_t zeroCopyFlags,
+                                                        const std::uint32_t bufferIndex) noexcept -> Submission {
+    io_uring_prep_send_zc_fixed(handle, socketFileDescriptor, std::data(buffer), std::size(buffer), flags,
+                                zeroCopyFlags, bufferIndex);
+
+    return Submission{handle};
+}
+
 auto coContext::internal::Submission::splice(io_uring_sqe *const handle, const std::int32_t inFileDescriptor,
                                              const std::int64_t inOffset, const std::int32_t outFileDescriptor,
                                              const std::int64_t outOffset, const std::uint32_t length,
@@ -349,6 +386,14 @@ auto coContext::internal::Submission::read(io_uring_sqe *const handle, const std
     return Submission{handle};
 }
 
+auto coContext::internal::Submission::readFixed(io_uring_sqe *const handle, const std::int32_t fileDescriptor,
+                                                const std::span<std::byte> buffer, const std::uint64_t offset,
+                                                const std::int32_t bufferIndex) noexcept -> Submission {
+    io_uring_prep_read_fixed(handle, fileDescriptor, std::data(buffer), std::size(buffer), offset, bufferIndex);
+
+    return Submission{handle};
+}
+
 auto coContext::internal::Submission::multipleRead(io_uring_sqe *const handle, const std::int32_t fileDescriptor,
                                                    const std::uint32_t length, const std::uint64_t offset,
                                                    const std::int32_t bufferGroup) noexcept -> Submission {
@@ -381,6 +426,14 @@ auto coContext::internal::Submission::write(io_uring_sqe *const handle, const st
     return Submission{handle};
 }
 
+auto coContext::internal::Submission::writeFixed(io_uring_sqe *const handle, const std::int32_t fileDescriptor,
+                                                 const std::span<const std::byte> buffer, const std::uint64_t offset,
+                                                 const std::int32_t bufferIndex) noexcept -> Submission {
+    io_uring_prep_write_fixed(handle, fileDescriptor, std::data(buffer), std::size(buffer), offset, bufferIndex);
+
+    return Submission{handle};
+}
+
 auto coContext::internal::Submission::syncFile(io_uring_sqe *const handle, const std::int32_t fileDescriptor,
                                                const std::uint32_t flags) noexcept -> Submission {
     io_uring_prep_fsync(handle, fileDescriptor, flags);
@@ -608,6 +661,40 @@ auto coContext::internal::Submission::setBufferGroup(const std::int32_t bufferGr
     io_uring_sqe_set_buf_group(this->handle, bufferGroup);
 }
 
+auto coContext::internal::Submission::setTimeSpecification(
+    const __kernel_timespec *const timeSpecification) const noexcept -> void {
+    // a timeout reads its time from addr, an update of one from addr2
+    const auto address{reinterpret_cast<std::uint64_t>(timeSpecification)};
+    if (this->handle->opcode == IORING_OP_TIMEOUT_REMOVE) this->handle->addr2 = address;
+    else this->handle->addr = address;
+}
+
+auto coContext::internal::Submission::setTimeoutFlags(const std::uint32_t flags) const noexcept -> void {
+    this->handle->timeout_flags = flags;
+}
+
+auto coContext::internal::Submission::isSingleShot() const noexcept -> bool {
+    switch (this->handle->opcode) {
+        case IORING_OP_ASYNC_CANCEL:
+        case IORING_OP_TIMEOUT_REMOVE:
+        case IORING_OP_POLL_REMOVE:
+        case IORING_OP_LINK_TIMEOUT:
+        case IORING_OP_READ_MULTISHOT:
+            return false;
+        case IORING_OP_ACCEPT:
+            return (this->handle->ioprio & IORING_ACCEPT_MULTISHOT) == 0;
+        case IORING_OP_RECV:
+        case IORING_OP_RECVMSG:
+            return (this->handle->ioprio & IORING_RECV_MULTISHOT) == 0;
+        case IORING_OP_POLL_ADD:
+            return (this->handle->len & IORING_POLL_ADD_MULTI) == 0;
+        case IORING_OP_TIMEOUT:
+            return (this->handle->timeout_flags & IORING_TIMEOUT_MULTISHOT) == 0;
+        default:
+            return true;
+    }
+}
+
 auto coContext::internal::operator==(const Submission lhs, const Submission rhs) noexcept -> bool {
     return lhs.get() == rhs.get();
 }